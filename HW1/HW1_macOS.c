@@ -1,20 +1,133 @@
+#include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "../renderer/renderer.h"
 
+#define KEYFRAME_LINE_LENGTH 1024
+#define FRAME_STREAM_BUFFER_SIZE 4194304
+
+/* Helper functions for single frames */
+static int renderframe(const char *, const char *, bool);
+
+/* Helper functions for batch rendering */
+static int renderturntable(const char *, const char *, const char *, unsigned int, FILE *);
+static int renderkeyframes(const char *, const char *, const char *, unsigned int, FILE *);
+static renderer_context * beginbatch(const char *, triangles *, unsigned int, FILE *, renderer_batch * *);
+static int submitframe(renderer_context *, renderer_batch *, unsigned int, const char *, unsigned int);
+static int endbatch(int, renderer_context * *, triangles *, renderer_batch * *);
+static FILE * openframestream(const char *);
+static int closeframestream(FILE *, int);
+
+/* Helper functions for render statistics */
+static void printrenderstats(const renderer_stats *);
+
 int main(int argc, char * argv[])
 {
-    if (argc != 3) {
-        puts("Usage:\n    ./HW1 [path to RAW triangle file] [path to output PNG file]");
+    if (argc == 4 && strcmp(argv[1], "--convert") == 0) {
+        triangles rawtriangles = {0};
+        loadrawtriangles(argv[2], &rawtriangles);
+        if (geterror() != RENDERER_ERROR_NONE) {
+            fputs(geterrortext(geterror()), stderr);
+            return 1;
+        }
+        savebinarytriangles(&rawtriangles, argv[3]);
+        if (geterror() != RENDERER_ERROR_NONE) {
+            fputs(geterrortext(geterror()), stderr);
+            return 1;
+        }
+        releasetriangles(&rawtriangles);
+        return 0;
+    }
+    unsigned int workercount = 1U;
+    bool streaming = false;
+    bool printstats = false;
+    const char * tracefilename = NULL;
+    for (;;) {
+        char extra;
+        if (argc >= 3 && strcmp(argv[1], "--workers") == 0) {
+            if (sscanf(argv[2], "%u%c", &workercount, &extra) != 1 || workercount == 0U || workercount > 256U) {
+                fputs(geterrortext(RENDERER_ERROR_INVALIDVALUE), stderr);
+                return 1;
+            }
+            argc -= 2;
+            argv += 2;
+        } else if (argc >= 2 && strcmp(argv[1], "--stream") == 0) {
+            streaming = true;
+            argc -= 1;
+            argv += 1;
+        } else if (argc >= 2 && strcmp(argv[1], "--stats") == 0) {
+            printstats = true;
+            argc -= 1;
+            argv += 1;
+        } else if (argc >= 3 && strcmp(argv[1], "--trace") == 0) {
+            tracefilename = argv[2];
+            argc -= 2;
+            argv += 2;
+        } else {
+            break;
+        }
+    }
+    bool batchmode = argc == 5 && (strcmp(argv[1], "--turntable") == 0 || strcmp(argv[1], "--keyframes") == 0);
+    if (!batchmode && argc != 3) {
+        puts("Usage:\n    ./HW1 [--stats] [--trace file] [path to RAW or RAWBIN triangle file] [path to output PNG, PPM, PAM, QOI or RGBA file]\n    ./HW1 --convert [path to RAW triangle file] [path to output RAWBIN file]\n"
+            "    ./HW1 [--workers count] [--stream] [--trace file] --turntable [frame count] [path to RAW or RAWBIN triangle file] [output PNG file prefix]\n"
+            "    ./HW1 [--workers count] [--stream] [--trace file] --keyframes [path to keyframe file] [path to RAW or RAWBIN triangle file] [output PNG file prefix]\n\n"
+            "Turntable mode rotates the object a full turn around the Y axis, starting at ObjectRotationY from renderer.ini.\n"
+            "Keyframe files hold one frame per line as Key=Value pairs separated by spaces, using the keys of renderer.ini.\n"
+            "Every line changes the configuration of the frame before it, blank lines and lines starting with # are skipped.\n"
+            "Frames are written to the prefix followed by the frame number, as in prefix0000.png, or with the extension of OutputFormat.\n"
+            "Batch modes render that many frames at once while earlier frames are written, each frame on one thread unless RenderThreads is set.\n"
+            "With --stream the prefix is a file or named pipe, or - for standard output, that gets every frame as raw RGBA pixels back to back,\n"
+            "as in ./HW1 --stream --turntable 120 model.raw - | ffmpeg -f rawvideo -pix_fmt rgba -s 1200x1200 -i - turntable.mp4\n"
+            "With --stats a single frame prints the time of each stage and the triangle and sample counts of its render to standard error.\n"
+            "With --trace the stages of loading, rendering and saving are written to the file as a Chrome trace-event JSON timeline.");
         return 0;
     }
+    if (tracefilename != NULL) {
+        int error = opentracefile(tracefilename);
+        if (error != RENDERER_ERROR_NONE) {
+            fputs(geterrortext(error), stderr);
+            return 1;
+        }
+    }
+    int result;
+    if (batchmode) {
+        FILE * stream = NULL;
+        if (streaming) {
+            stream = openframestream(argv[4]);
+        }
+        if (streaming && stream == NULL) {
+            fputs(geterrortext(RENDERER_ERROR_FILEOPENFAILED), stderr);
+            result = 1;
+        } else if (strcmp(argv[1], "--turntable") == 0) {
+            result = closeframestream(stream, renderturntable(argv[2], argv[3], argv[4], workercount, stream));
+        } else {
+            result = closeframestream(stream, renderkeyframes(argv[2], argv[3], argv[4], workercount, stream));
+        }
+    } else {
+        result = renderframe(argv[1], argv[2], printstats);
+    }
+    if (tracefilename != NULL) {
+        int error = closetracefile();
+        if (error != RENDERER_ERROR_NONE && result == 0) {
+            fputs(geterrortext(error), stderr);
+            result = 1;
+        }
+    }
+    return result;
+}
+
+static int renderframe(const char * trianglefilename, const char * outputfilename, bool printstats)
+{
     readconfigurations();
     if (geterror() != RENDERER_ERROR_NONE) {
         fputs(geterrortext(geterror()), stderr);
         return 1;
     }
     triangles rawtriangles = {0};
-    loadrawtriangles(argv[1], &rawtriangles);
+    loadtriangles(trianglefilename, &rawtriangles);
     if (geterror() != RENDERER_ERROR_NONE) {
         fputs(geterrortext(geterror()), stderr);
         return 1;
@@ -30,11 +143,215 @@ int main(int argc, char * argv[])
         return 1;
     }
     releasetriangles(&rawtriangles);
-    savesurfacetopngfile(rendertarget, argv[2]);
+    savesurfacetofile(rendertarget, outputfilename);
     if (geterror() != RENDERER_ERROR_NONE) {
         fputs(geterrortext(geterror()), stderr);
         return 1;
     }
     releasesurface(&rendertarget);
+    if (printstats) {
+        renderer_stats stats;
+        getrenderstats(&stats);
+        printrenderstats(&stats);
+    }
     return 0;
 }
+
+static int renderturntable(const char * framecounttext, const char * trianglefilename, const char * prefix, unsigned int workercount, FILE * stream)
+{
+    unsigned int framecount;
+    char extra;
+    if (sscanf(framecounttext, "%u%c", &framecount, &extra) != 1 || framecount == 0U || framecount > 99999U) {
+        fputs(geterrortext(RENDERER_ERROR_INVALIDVALUE), stderr);
+        return 1;
+    }
+
+    triangles rawtriangles = {0};
+    renderer_batch * batch = NULL;
+    renderer_context * context = beginbatch(trianglefilename, &rawtriangles, workercount, stream, &batch);
+    if (context == NULL) {
+        return 1;
+    }
+    configurations configstruct;
+    getconfigurations_ctx(context, &configstruct);
+    float startangle = configstruct.objectrotationy;
+
+    for (unsigned int frameindex = 0U; frameindex < framecount; frameindex += 1U) {
+        char value[64];
+        snprintf(value, sizeof value, "%f", startangle + 360.F * (float)frameindex / (float)framecount);
+        setconfiguration_ctx(context, "ObjectRotationY", value);
+        int error = geterror_ctx(context);
+        if (error == RENDERER_ERROR_NONE) {
+            error = submitframe(context, batch, workercount, stream == NULL ? prefix : NULL, frameindex);
+        }
+        if (error != RENDERER_ERROR_NONE) {
+            return endbatch(error, &context, &rawtriangles, &batch);
+        }
+    }
+    return endbatch(RENDERER_ERROR_NONE, &context, &rawtriangles, &batch);
+}
+
+static int renderkeyframes(const char * keyframefilename, const char * trianglefilename, const char * prefix, unsigned int workercount, FILE * stream)
+{
+    FILE * keyframefile = fopen(keyframefilename, "r");
+    if (keyframefile == NULL) {
+        fputs(geterrortext(RENDERER_ERROR_FILEOPENFAILED), stderr);
+        return 1;
+    }
+
+    triangles rawtriangles = {0};
+    renderer_batch * batch = NULL;
+    renderer_context * context = beginbatch(trianglefilename, &rawtriangles, workercount, stream, &batch);
+    if (context == NULL) {
+        fclose(keyframefile);
+        return 1;
+    }
+
+    unsigned int frameindex = 0U;
+    char line[KEYFRAME_LINE_LENGTH];
+    while (fgets(line, sizeof line, keyframefile) != NULL) {
+        if (strchr(line, '\n') == NULL && !feof(keyframefile)) {
+            fclose(keyframefile);
+            return endbatch(RENDERER_ERROR_LINETOOLONG, &context, &rawtriangles, &batch);
+        }
+        char * token = strtok(line, " \t\r\n");
+        if (token == NULL || token[0] == '#') {
+            continue;
+        }
+
+        /* Apply this frame's changes on top of the previous frame */
+        for (; token != NULL; token = strtok(NULL, " \t\r\n")) {
+            char * separator = strchr(token, '=');
+            if (separator == NULL) {
+                fclose(keyframefile);
+                return endbatch(RENDERER_ERROR_CONFIGWRONGFORMAT, &context, &rawtriangles, &batch);
+            }
+            *separator = '\0';
+            setconfiguration_ctx(context, token, separator + 1);
+            if (geterror_ctx(context) != RENDERER_ERROR_NONE) {
+                fclose(keyframefile);
+                return endbatch(geterror_ctx(context), &context, &rawtriangles, &batch);
+            }
+        }
+        int error = submitframe(context, batch, workercount, stream == NULL ? prefix : NULL, frameindex);
+        if (error != RENDERER_ERROR_NONE) {
+            fclose(keyframefile);
+            return endbatch(error, &context, &rawtriangles, &batch);
+        }
+        frameindex += 1U;
+    }
+
+    fclose(keyframefile);
+    return endbatch(RENDERER_ERROR_NONE, &context, &rawtriangles, &batch);
+}
+
+static renderer_context * beginbatch(const char * trianglefilename, triangles * rawtriangles, unsigned int workercount, FILE * stream, renderer_batch * * batch)
+{
+    /* The configuration and the triangles are read once for all frames */
+    renderer_context * context = createrenderercontext();
+    if (context == NULL) {
+        fputs(geterrortext(RENDERER_ERROR_INSUFFICIENTMEMORY), stderr);
+        return NULL;
+    }
+    readconfigurations_ctx(context);
+    if (geterror_ctx(context) == RENDERER_ERROR_NONE) {
+        loadtriangles_ctx(context, trianglefilename, rawtriangles);
+    }
+    if (geterror_ctx(context) != RENDERER_ERROR_NONE) {
+        endbatch(geterror_ctx(context), &context, NULL, NULL);
+        return NULL;
+    }
+    *batch = createrendererbatchstream(rawtriangles, workercount, workercount * 2U, stream);
+    if (*batch == NULL) {
+        endbatch(RENDERER_ERROR_INSUFFICIENTMEMORY, &context, rawtriangles, NULL);
+        return NULL;
+    }
+    return context;
+}
+
+static int submitframe(renderer_context * context, renderer_batch * batch, unsigned int workercount, const char * prefix, unsigned int frameindex)
+{
+    /* Frames run side by side, so splitting each frame over every processor as well would oversubscribe them */
+    configurations configstruct;
+    getconfigurations_ctx(context, &configstruct);
+    if (workercount > 1U && configstruct.renderthreads == 0U) {
+        configstruct.renderthreads = 1U;
+    }
+
+    if (prefix == NULL) {
+        return submitbatchframe(batch, &configstruct, NULL);
+    }
+    static const char * const extensions[] = {"png", "png", "ppm", "pam", "qoi", "rgba"};
+    size_t length = strlen(prefix) + 16;
+    char * filename = malloc(length);
+    if (filename == NULL) {
+        return RENDERER_ERROR_INSUFFICIENTMEMORY;
+    }
+    snprintf(filename, length, "%s%04u.%s", prefix, frameindex, extensions[configstruct.outputformat]);
+    int error = submitbatchframe(batch, &configstruct, filename);
+    free(filename);
+    return error;
+}
+
+static int endbatch(int error, renderer_context * * context, triangles * rawtriangles, renderer_batch * * batch)
+{
+    /* Waits for every submitted frame, a failure while rendering or writing them is reported here */
+    if (batch != NULL && *batch != NULL) {
+        int batcherror = finishrendererbatch(batch);
+        if (error == RENDERER_ERROR_NONE) {
+            error = batcherror;
+        }
+    }
+    if (rawtriangles != NULL) {
+        releasetriangles(rawtriangles);
+    }
+    releaserenderercontext(context);
+    if (error != RENDERER_ERROR_NONE) {
+        fputs(geterrortext(error), stderr);
+        return 1;
+    }
+    return 0;
+}
+
+static FILE * openframestream(const char * filename)
+{
+    /* Frames are large, so the stream gets a buffer that holds several megabytes of pixels at once */
+    FILE * stream = strcmp(filename, "-") == 0 ? stdout : fopen(filename, "wb");
+    if (stream != NULL) {
+        setvbuf(stream, NULL, _IOFBF, FRAME_STREAM_BUFFER_SIZE);
+    }
+    return stream;
+}
+
+static int closeframestream(FILE * stream, int result)
+{
+    if (stream == NULL) {
+        return result;
+    }
+    int error = stream == stdout ? fflush(stream) : fclose(stream);
+    if (error == EOF && result == 0) {
+        fputs(geterrortext(RENDERER_ERROR_FILEWRITEFAILED), stderr);
+        return 1;
+    }
+    return result;
+}
+
+static void printrenderstats(const renderer_stats * stats)
+{
+    fprintf(stderr, "Cull                %10.3f ms\n", stats->culltime);
+    fprintf(stderr, "Transform           %10.3f ms\n", stats->transformtime);
+    fprintf(stderr, "Light               %10.3f ms\n", stats->lighttime);
+    fprintf(stderr, "Clip                %10.3f ms\n", stats->cliptime);
+    fprintf(stderr, "Sort                %10.3f ms\n", stats->sorttime);
+    fprintf(stderr, "Raster              %10.3f ms\n", stats->rastertime);
+    fprintf(stderr, "Resolve             %10.3f ms\n", stats->resolvetime);
+    fprintf(stderr, "Encode              %10.3f ms\n", stats->encodetime);
+    fprintf(stderr, "Triangles in        %10zu\n", stats->trianglesin);
+    fprintf(stderr, "Triangles culled    %10zu\n", stats->trianglesculled);
+    fprintf(stderr, "Triangles clipped   %10zu\n", stats->trianglesclipped);
+    fprintf(stderr, "Triangles split     %10zu\n", stats->trianglessplit);
+    fprintf(stderr, "Triangles drawn     %10zu\n", stats->trianglesrasterized);
+    fprintf(stderr, "Samples tested      %10" PRIu64 "\n", stats->samplestested);
+    fprintf(stderr, "Samples written     %10" PRIu64 "\n", stats->sampleswritten);
+    fprintf(stderr, "Peak scratch memory %10zu bytes\n", stats->peakscratchmemory);
+}
@@ -9,10 +9,10 @@ WCHAR errortext[64];
 char modelname[MAX_PATH];
 WORD modelnameindex;
 const WCHAR classname[] = L"HW1";
-const char openfilter[] = "RAW Triangle Files (*.raw)\0*.raw\0All Files (*.*)\0*.*\0\0";
+const char openfilter[] = "RAW Triangle Files (*.raw)\0*.raw\0Binary RAW Triangle Files (*.rawbin)\0*.rawbin\0All Files (*.*)\0*.*\0\0";
 const char opentitle[] = "Open a RAW triangle file";
 const char rawext[] = "raw";
-const char savefilter[] = "PNG (*.png)\0*.png\0\0";
+const char savefilter[] = "PNG (*.png)\0*.png\0PPM (*.ppm)\0*.ppm\0PAM (*.pam)\0*.pam\0QOI (*.qoi)\0*.qoi\0Raw RGBA (*.rgba)\0*.rgba\0\0";
 const char savetitle[] = "Save to PNG file";
 const char pngext[] = "png";
 const WCHAR enabledtext[] = L"Enabled";
@@ -222,7 +222,7 @@ LRESULT CALLBACK windowprocedure(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lPa
                 }
                 releasetriangles(&rawtriangles);
                 starttime = timeGetTime();
-                loadrawtriangles(openfilename.lpstrFile, &rawtriangles);
+                loadtriangles(openfilename.lpstrFile, &rawtriangles);
                 if (geterror() != RENDERER_ERROR_NONE) {
                     displayerrortext(NULL);
                     DestroyWindow(hWnd);
@@ -286,7 +286,7 @@ LRESULT CALLBACK windowprocedure(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lPa
                     displayerrortext(NULL);
                     DestroyWindow(hWnd);
                 }
-                savesurfacetopngfile(rendertarget, openfilename.lpstrFile);
+                savesurfacetofile(rendertarget, openfilename.lpstrFile);
                 if (geterror() != RENDERER_ERROR_NONE) {
                     displayerrortext(NULL);
                     DestroyWindow(hWnd);
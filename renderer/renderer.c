@@ -1,29 +1,125 @@
 #if _MSC_VER >= 1400
 #define _CRT_SECURE_NO_DEPRECATE
 #endif
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+#if defined(__APPLE__) && defined(__MACH__) && !defined(_DARWIN_C_SOURCE)
+#define _DARWIN_C_SOURCE
+#endif
 
 #include "renderer.h"
 
-#if defined(__APPLE__) && defined(__MACH__)
-#include <Accelerate/Accelerate.h>
-#else
-#include <cblas.h>
-#endif
 #include <confini.h>
 #if defined(__APPLE__) && defined(__MACH__)
 #include <png/png.h>
 #else
 #include <png.h>
 #endif
+#include <zlib.h>
 
 #include <assert.h>
+#include <ctype.h>
 #include <float.h>
+#include <limits.h>
 #include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <time.h>
+#include <unistd.h>
+#endif
+
+#if !defined(RENDERER_DISABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define RENDERER_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define RENDERER_TARGET_AVX2
+#else
+#define RENDERER_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#define RENDERER_THREAD_LOCAL __declspec(thread)
+#else
+#define RENDERER_THREAD_LOCAL _Thread_local
+#endif
+
+#define RAW_LINE_LENGTH 1024
+#define RAW_CHUNK_MINIMUM_SIZE 1048576
+
+#define BINARY_MAGIC "RAWBIN\r\n"
+#define BINARY_VERSION 1U
+
+#define RAW_RGBA_MAGIC "RGBA"
+
+#define QOI_BUFFER_SIZE 65536
+
+#define OUTCODE_LEFT 1U
+#define OUTCODE_RIGHT 2U
+#define OUTCODE_BOTTOM 4U
+#define OUTCODE_TOP 8U
+#define OUTCODE_NEAR 16U
+#define OUTCODE_FAR 32U
+#define OUTCODE_BEHIND 64U
+#define OUTCODE_GUARDBAND 128U
+
+#define GUARD_BAND_SIZE 16384.F
+
+#define RENDERER_CONTEXT_DEFAULTS { \
+    RENDERER_ERROR_NONE, {'\0'}, \
+    {0.F, 0.F, 0.F}, {0.F, 0.F, 0.F}, {0.F, 0.F, 0.F}, {0.F, 1.F, 0.F}, {0.F, 0.F, 0.F}, \
+    0.F, 0.F, 0.F, 0.F, 0.F, 0.F, \
+    1.F, 1.F, 1.F, \
+    3.14159265F / 2.F, 90.F, 0.1F, 100.F, \
+    600U, 600U, \
+    {1.F, 1.F, 1.F}, 255, 255, 255, \
+    false, false, false, 0U, 2U, \
+    6, RENDERER_PNG_FILTER_ADAPTIVE, false, RENDERER_OUTPUT_FORMAT_AUTO, \
+    NULL, false, \
+    {NULL, NULL, 0, 0, 0, NULL}, \
+    {0, 0, NULL, NULL, NULL, NULL, NULL}, \
+    {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0, 0, 0, 0, 0, 0, 0} \
+}
+
+#define SCRATCH_ALIGNMENT 64
+
+#define PNG_BAND_MINIMUM_ROWS 64
+#define PNG_BAND_MAXIMUM_SIZE 1073741824U
+#define PNG_CHUNK_MAXIMUM_SIZE 1073741824U
+
+#define DEPTH_SORT_BUCKETS 4096
+
+#define RADIX_SORT_BITS 8
+#define RADIX_SORT_BUCKETS 256
+#define RADIX_SORT_MINIMUM_CHUNK 65536
+
+#define PIPELINE_MINIMUM_CHUNK 16384
+
+#define BVH_LEAF_SIZE 16
+#define BVH_MORTON_BITS 10
+
+#define RASTER_TILE_SIZE 64
+#define RASTER_BLOCK_SIZE 8
+
+/* Blocks a tile can touch along one axis, a tile need not start on a block boundary */
+#define HIERARCHICAL_Z_COLUMNS (RASTER_TILE_SIZE / RASTER_BLOCK_SIZE + 1)
+
+#define TRACE_THREAD_SLOTS 1024
+
+#define THREAD_POOL_MAXIMUM_SIZE 256
 
 typedef struct vector {
     float x;
@@ -42,7 +138,331 @@ typedef struct polygon {
     point vertices[9];
 } polygon;
 
-int errornumber = 0;
+/* Structure-of-arrays vertex storage */
+typedef struct vertexstreams {
+    size_t size;
+    float * x;
+    float * y;
+    float * z;
+    float * w;
+} vertexstreams;
+
+/* Bounding box of bvhtriangles[first] to bvhtriangles[first + count - 1], the subtree ends before node next */
+typedef struct bvhnode {
+    float minimum[3];
+    float maximum[3];
+    uint32_t first;
+    uint32_t count;
+    uint32_t next;
+} bvhnode;
+
+/* Unique vertices of a triangle list with three vertex indices per triangle */
+typedef struct indexedmesh {
+    vertexstreams vertices;
+    size_t trianglecount;
+    uint32_t * indices;
+    bvhnode * nodes;
+    size_t nodecount;
+    uint32_t * bvhtriangles;
+    bool mapped;
+} indexedmesh;
+
+/* Per-vertex results of the vertex stage */
+typedef struct transformedvertices {
+    size_t size;
+    float * viewx;
+    float * viewy;
+    float * viewz;
+    float * clipx;
+    float * clipy;
+    float * clipz;
+    float * clipw;
+    float * ndcz;
+    float * screenx;
+    float * screeny;
+    uint8_t * outcodes;
+} transformedvertices;
+
+/* Structure-of-arrays triangle storage, vertex k of triangle t is at index t * 3 + k of every stream */
+typedef struct trianglestreams {
+    size_t size;
+    size_t capacity;
+    float * x;
+    float * y;
+    float * z;
+    float * w;
+    light * lighting;
+} trianglestreams;
+
+/* Frame allocator, requests that do not fit go to overflow blocks and the next reset grows the arena to the peak */
+typedef struct scratcharena {
+    void * block;
+    char * data;
+    size_t capacity;
+    size_t used;
+    size_t peak;
+    void * overflow;
+} scratcharena;
+
+typedef struct rendererthread {
+#if defined(_WIN32)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    void (* procedure)(void *);
+    void * argument;
+} rendererthread;
+
+#if defined(_WIN32)
+typedef CRITICAL_SECTION renderermutex;
+typedef CONDITION_VARIABLE rendererconditionvariable;
+#else
+typedef pthread_mutex_t renderermutex;
+typedef pthread_cond_t rendererconditionvariable;
+#endif
+
+#if defined(_WIN32)
+typedef INIT_ONCE rendereronce;
+#define RENDERER_ONCE_INITIALIZER INIT_ONCE_STATIC_INIT
+#else
+typedef pthread_once_t rendereronce;
+#define RENDERER_ONCE_INITIALIZER PTHREAD_ONCE_INIT
+#endif
+
+/* One runinparallel call, items are claimed through nextitem and counted off in finisheditems */
+typedef struct paralleljob {
+    void (* procedure)(void *);
+    char * arguments;
+    size_t argumentsize;
+    size_t count;
+    size_t nextitem;
+    size_t finisheditems;
+    struct paralleljob * next;
+} paralleljob;
+
+typedef struct mappedfile {
+    const char * data;
+    size_t size;
+#if defined(_WIN32)
+    HANDLE file;
+    HANDLE mapping;
+#endif
+    char * buffer;
+} mappedfile;
+
+/* Header of a binary triangle file, with the size and modification time of the RAW file it came from, sections follow in this order at 16-byte aligned offsets */
+typedef struct binaryheader {
+    char magic[8];
+    uint32_t version;
+    uint32_t stride;
+    uint64_t size;
+    uint64_t dataoffset;
+    uint64_t sourcesize;
+    uint64_t sourcemodified;
+    uint64_t vertexcount;
+    uint64_t vertexoffset;
+    uint64_t indexoffset;
+    uint64_t nodecount;
+    uint64_t nodeoffset;
+    uint64_t bvhtriangleoffset;
+} binaryheader;
+
+typedef struct rawchunk {
+    const char * start;
+    const char * end;
+    triangle * data;
+    size_t linecount;
+    size_t offset;
+    size_t loaded;
+    bool linetoolong;
+} rawchunk;
+
+/* One range of triangles backface culled by one thread, counted in a first pass and written from offset in a second */
+typedef struct cullchunk {
+    const indexedmesh * mesh;
+    const uint32_t * indices;
+    const point * modelspacecameraposition;
+    uint8_t * frontfacing;
+    uint32_t * visibleindices;
+    size_t first;
+    size_t last;
+    size_t count;
+    size_t offset;
+} cullchunk;
+
+/* One range of triangles lit, clipped and stored by one thread, counted in a first pass and written from offset in a second */
+typedef struct assemblychunk {
+    const transformedvertices * vertices;
+    const uint32_t * indices;
+    const point * viewspacelightsourceposition;
+    const light * material;
+    float width;
+    float height;
+    float guardbandx;
+    float guardbandy;
+    uint8_t * outputcounts;
+    trianglestreams * streams;
+    size_t first;
+    size_t last;
+    size_t count;
+    size_t offset;
+    size_t rejectedcount;
+    size_t clippedcount;
+    size_t splitcount;
+} assemblychunk;
+
+/* Pairs of one range counted and scattered by one thread in each radix sort pass */
+typedef struct radixsortchunk {
+    const uint32_t * keys;
+    const size_t * indices;
+    uint32_t * sortedkeys;
+    size_t * sortedindices;
+    size_t first;
+    size_t last;
+    unsigned int shift;
+    size_t offsets[RADIX_SORT_BUCKETS];
+} radixsortchunk;
+
+typedef struct rastertriangle {
+    int64_t edgex[3];
+    int64_t edgey[3];
+    int64_t edgeconstant[3];
+    vector normal;
+    float d;
+    uint32_t color;
+} rastertriangle;
+
+/* Span kernels return the number of samples they wrote */
+typedef int (* rasterspankernel)(const rastertriangle *, int32_t, int32_t, int32_t, int, int, int, uint32_t *, float *);
+
+/* Configuration and error state of one renderer, rendering with different contexts may run concurrently */
+struct renderer_context {
+    int errornumber;
+    char inisection[64];
+    point lightsourceposition;
+    point cameraposition;
+    point cameralookatpoint;
+    vector up;
+    point objectposition;
+    float objectrotationx;
+    float objectrotationy;
+    float objectrotationz;
+    float objectrotationxdegree;
+    float objectrotationydegree;
+    float objectrotationzdegree;
+    float objectscalingx;
+    float objectscalingy;
+    float objectscalingz;
+    float fieldofview;
+    float fieldofviewdegree;
+    float znear;
+    float zfar;
+    unsigned int outputwidth;
+    unsigned int outputheight;
+    light materialdiffusereflectance;
+    int materialdiffusereflectancered;
+    int materialdiffusereflectancegreen;
+    int materialdiffusereflectanceblue;
+    bool backfaceculling;
+    bool usezbuffer;
+    bool fronttobacksort;
+    unsigned int renderthreads;
+    unsigned int antialiasing;
+    int pngcompressionlevel;
+    int pngfilter;
+    bool pngparalleldeflate;
+    int outputformat;
+    rasterspankernel spankernel;
+    bool spankernelselected;
+    scratcharena scratch;
+    trianglestreams streams;
+    renderer_stats stats;
+};
+
+/* Rows of an image compressed on their own, the bands of one image concatenate into a single zlib stream */
+typedef struct pngband {
+    const surface * s;
+    int compressionlevel;
+    int filter;
+    size_t firstrow;
+    size_t lastrow;
+    bool last;
+    unsigned char * data;
+    size_t size;
+    size_t capacity;
+    uLong adler;
+    bool failed;
+} pngband;
+
+typedef struct batchframe {
+    configurations configuration;
+    char * filename;
+    size_t sequence;
+    surface * target;
+} batchframe;
+
+typedef struct batchworker {
+    renderer_batch * batch;
+    renderer_context * context;
+    rendererthread thread;
+    bool started;
+} batchworker;
+
+/* Render workers take frames from pending and hand finished frames to the encoders, surfaces in flight are capped */
+struct renderer_batch {
+    const triangles * rawtriangles;
+    FILE * stream;
+    size_t submittedcount;
+    size_t nextsequence;
+    size_t workercount;
+    batchworker * workers;
+    batchframe * pending;
+    size_t pendingcapacity;
+    size_t pendingfirst;
+    size_t pendingcount;
+    batchframe * finished;
+    size_t finishedfirst;
+    size_t finishedcount;
+    surface * * freesurfaces;
+    size_t freesurfacecount;
+    size_t surfacecount;
+    size_t surfacecapacity;
+    size_t runningrenderers;
+    bool closing;
+    int errornumber;
+    renderermutex mutex;
+    rendererconditionvariable changed;
+};
+
+typedef struct rasterjob {
+    rasterspankernel spankernel;
+    const trianglestreams * streams;
+    const size_t * binoffsets;
+    const size_t * binentries;
+    uint32_t * samplesurface;
+    float * zbuffer;
+    surface * target;
+    int samplegrid;
+    int samplewidth;
+    int sampleheight;
+    int tilesize;
+    size_t tilecolumns;
+    size_t tilerows;
+    size_t nexttile;
+    double rastertime;
+    double resolvetime;
+    uint64_t samplestested;
+    uint64_t sampleswritten;
+    renderermutex mutex;
+} rasterjob;
+
+/* A timed region on one thread, written as a complete event when it ends, a zone never ended leaves no event */
+typedef struct tracezone {
+    const char * name;
+    double start;
+} tracezone;
+
 const char * errortexts[] = {
     "No error",
     "Invalid argument value",
@@ -50,11 +470,11 @@ const char * errortexts[] = {
     "Failed to close file",
     "Out of memory",
     "RAW triangle file line too long (over 1024 characters)",
-    "Configuration wrong format"
+    "Configuration wrong format",
+    "Failed to write file",
+    "Binary triangle file wrong format"
 };
 
-char inisection[64] = {'\0'};
-
 const float identitymatrix[16] = {
     1.F, 0.F, 0.F, 0.F,
     0.F, 1.F, 0.F, 0.F,
@@ -62,37 +482,47 @@ const float identitymatrix[16] = {
     0.F, 0.F, 0.F, 1.F
 };
 
-float previousmatrix[16];
-
-point lightsourceposition = {0.F, 0.F, 0.F};
-point cameraposition = {0.F, 0.F, 0.F};
-point cameralookatpoint = {0.F, 0.F, 0.F};
-vector up = {0.F, 1.F, 0.F};
-point objectposition = {0.F, 0.F, 0.F};
-float objectrotationx = 0.F;
-float objectrotationy = 0.F;
-float objectrotationz = 0.F;
-float objectrotationxdegree = 0.F;
-float objectrotationydegree = 0.F;
-float objectrotationzdegree = 0.F;
-float objectscalingx = 1.F;
-float objectscalingy = 1.F;
-float objectscalingz = 1.F;
-float fieldofview = 3.14159265F / 2.F;
-float fieldofviewdegree = 90.F;
-float znear = 0.1F;
-float zfar = 100.F;
-unsigned int outputwidth = 600U;
-unsigned int outputheight = 600U;
-light materialdiffusereflectance = {1.F, 1.F, 1.F};
-int materialdiffusereflectancered = 255;
-int materialdiffusereflectancegreen = 255;
-int materialdiffusereflectanceblue = 255;
-bool backfaceculling = false;
-bool usezbuffer = false;
+static renderer_context defaultcontext = RENDERER_CONTEXT_DEFAULTS;
+
+/* Trace events of every context and thread go to one timeline, threads take the lowest free lane while they run */
+static FILE * tracefile = NULL;
+static rendereronce tracemutexonce = RENDERER_ONCE_INITIALIZER;
+static renderermutex tracemutex;
+static double tracestart;
+static unsigned int tracegeneration = 0U;
+static bool traceeventwritten;
+static bool tracewritefailed;
+static bool tracethreadslots[TRACE_THREAD_SLOTS];
+static unsigned int traceoverflowthreads;
+static RENDERER_THREAD_LOCAL unsigned int tracethread;
+static RENDERER_THREAD_LOCAL unsigned int tracethreadgeneration;
+
+/* Worker threads shared by every context, started when a call first needs them and kept until the process exits */
+static rendereronce threadpoolonce = RENDERER_ONCE_INITIALIZER;
+static renderermutex threadpoolmutex;
+static rendererconditionvariable threadpoolwork;
+static rendererconditionvariable threadpooldone;
+static paralleljob * threadpooljobs = NULL;
+static size_t threadpoolsize = 0;
+static rendererthread threadpoolthreads[THREAD_POOL_MAXIMUM_SIZE];
+
+/* Helper functions for RAW triangle loading */
+static bool isfileuptodate(const char *, const char *);
+static bool getfilestamp(const char *, uint64_t *, uint64_t *);
+static bool isbinaryheadervalid(const binaryheader *, size_t);
+static uint64_t getbinaryfilesize(const binaryheader *);
+static uint64_t alignbinaryoffset(uint64_t);
+static bool writebinarysection(FILE *, uint64_t *, uint64_t, const void *, size_t);
+static bool openmappedfile(mappedfile *, const char *, bool);
+static bool closemappedfile(mappedfile *);
+static void countrawchunklines(void *);
+static void parserawchunk(void *);
+static bool parserawtriangle(const char *, const char *, triangle *);
+static const char * parsefloat(const char *, const char *, float *);
 
 /* Helper functions for INI parsing */
 static int inicallback(IniDispatch *, void *);
+static bool applyconfiguration(renderer_context *, const char *, const char *);
 static float degreetoradian(float);
 static bool ishexadecimalcharacter(char);
 static int hexadecimalcharactertovalue(char);
@@ -105,170 +535,700 @@ static void normalize(vector *);
 /* Helper functions for matrix operations */
 static void calculatenewtransformationmatrix(float *, const float *);
 
-/* Helper function for Z-sorting using quicksort algorithm */
-static void zsortingsubroutine(triangle *, light *, intptr_t, intptr_t);
+/* Helper functions for indexed meshes */
+static indexedmesh * buildindexedmesh(const triangles *);
+static void releaseindexedmesh(indexedmesh *);
+static bool isindexedmeshvalid(const indexedmesh *);
+static void buildbvh(indexedmesh *);
+static void buildbvhnode(indexedmesh *, uint32_t, uint32_t);
+static uint32_t spreadmortonbits(uint32_t);
+static bool allocatevertexstreams(vertexstreams *, size_t);
+static void releasevertexstreams(vertexstreams *);
+
+/* Helper functions for scratch memory */
+static void * allocatescratch(scratcharena *, size_t);
+static void resetscratcharena(scratcharena *);
+static void releasescratcharena(scratcharena *);
+
+/* Helper functions for triangle streams */
+static bool reservetrianglestreams(trianglestreams *, size_t);
+static void storetriangle(trianglestreams *, size_t, const point *, const point *, const point *, const light *);
+static void releasetrianglestreams(trianglestreams *);
+
+/* Helper functions for the transform pipeline */
+static bool cullmeshfrustum(const indexedmesh *, const float *, uint64_t *);
+static size_t cullmeshtriangles(const indexedmesh *, const uint32_t *, size_t, const point *, uint8_t *, uint32_t *, cullchunk *, size_t);
+static void countfrontfacingtriangles(void *);
+static void writefrontfacingtriangles(void *);
+static bool allocatetransformedvertices(transformedvertices *, size_t, scratcharena *);
+static void transformvertices(const vertexstreams *, size_t, size_t, const float *, const float *, float, float, transformedvertices *);
+#if defined(RENDERER_SIMD_X86)
+static __m128 transformcomponentsse2(const __m128 *, const float *, size_t);
+#endif
+static void calculatelighting(const transformedvertices *, const uint32_t *, const point *, const light *, light *);
+static unsigned int getoutcode(float, float, float, float, float, float);
+static bool clipnearplane(const transformedvertices *, const uint32_t *, float, float, polygon *, unsigned int *);
+static void clippolygon(const polygon *, polygon *, size_t, float, bool);
+static float * getpointcomponent(point *, size_t);
+static bool assembletriangles(const transformedvertices *, const uint32_t *, size_t, const point *, const light *, float, float, trianglestreams *, uint8_t *, assemblychunk *, size_t, renderer_stats *);
+static void countassembledtriangles(void *);
+static void writeassembledtriangles(void *);
+static size_t assembletriangle(const assemblychunk *, const uint32_t *, polygon *, bool *);
+
+/* Helper functions for depth sorting */
+static void sortfronttoback(const trianglestreams *, uint16_t *, size_t *, size_t *);
+static size_t * radixsort(uint32_t *, size_t *, uint32_t *, size_t *, size_t, radixsortchunk *, size_t);
+static void countradixdigits(void *);
+static void scatterradixdigits(void *);
+static uint32_t floattosortablekey(float);
+
+/* Helper functions for tile-based rasterization */
+static bool gettrianglebounds(const trianglestreams *, size_t, int, int, int *, int *, int *, int *);
+static void rasterizationworker(void *);
+static void rasterizetile(const rasterjob *, size_t, uint64_t *, uint64_t *);
+static bool setuprastertriangle(const trianglestreams *, size_t, rastertriangle *);
+static void setupedge(rastertriangle *, size_t, int64_t, int64_t, int64_t, int64_t);
+static void getblockdepthrange(const rastertriangle *, int, int, int, int, float *, float *);
+static int rasterizespan(const rastertriangle *, int64_t, int64_t, int64_t, int, int, int, bool, uint32_t *, float *);
+
+/* Helper functions for SIMD coverage and depth testing */
+static rasterspankernel selectspankernel(void);
+#if defined(RENDERER_SIMD_X86)
+static int rasterizespansse2(const rastertriangle *, int32_t, int32_t, int32_t, int, int, int, uint32_t *, float *);
+RENDERER_TARGET_AVX2 static int rasterizespanavx2(const rastertriangle *, int32_t, int32_t, int32_t, int, int, int, uint32_t *, float *);
+static int countmaskbits(unsigned int);
+#endif
+static void resolvetile(const rasterjob *, size_t);
+
+/* Helper functions for PNG encoding */
+static bool writepngserially(const renderer_context *, const surface *, FILE *);
+static int writepnginparallel(const renderer_context *, const surface *, FILE *, size_t);
+static void compresspngband(void *);
+static bool deflatepngband(pngband *, z_stream *, const unsigned char *, size_t, int);
+static const unsigned char * filterpngrow(const surface *, size_t, int, unsigned char *);
+static bool writepngchunk(FILE *, const char *, const unsigned char *, size_t);
+static void storebigendian(unsigned char *, uint32_t);
+
+/* Helper functions for uncompressed output formats */
+static int getoutputformat(const renderer_context *, const char *);
+static bool hasfileextension(const char *, const char *);
+static bool writeppm(const surface *, FILE *);
+static bool writepam(const surface *, FILE *);
+static bool writeqoi(const surface *, FILE *);
+static bool writerawrgba(const surface *, FILE *);
+static bool writergbapixels(const uint32_t *, size_t, FILE *);
+static void storelittleendian(unsigned char *, uint32_t);
+
+/* Helper functions for batch rendering */
+static void batchrenderworker(void *);
+static void batchencodeworker(void *);
+static bool takefinishedframe(renderer_batch *, batchframe *);
+static void setbatcherror(renderer_batch *, int);
+
+/* Helper functions for tracing */
+static void begintracezone(tracezone *, const char *);
+static void endtracezone(const tracezone *);
+static unsigned int gettracethread(void);
+static void releasetracethread(void);
+static void initializetracemutex(void);
+static FILE * loadtracefile(void);
+static void storetracefile(FILE *);
+
+/* Helper functions for multithreading */
+static unsigned int getprocessorcount(void);
+static double getmilliseconds(void);
+static void runinparallel(void (*)(void *), void *, size_t, size_t);
+static void runparallelitem(paralleljob *);
+static void threadpoolworker(void *);
+static void initializethreadpool(void);
+static void runonce(rendereronce *, void (*)(void));
+static bool startthread(rendererthread *, void (*)(void *), void *);
+static void jointhread(rendererthread *);
+static void initializemutex(renderermutex *);
+static void lockmutex(renderermutex *);
+static void unlockmutex(renderermutex *);
+static void destroymutex(renderermutex *);
+static void initializeconditionvariable(rendererconditionvariable *);
+static void waitconditionvariable(rendererconditionvariable *, renderermutex *);
+static void broadcastconditionvariable(rendererconditionvariable *);
+static void destroyconditionvariable(rendererconditionvariable *);
+
+renderer_context * createrenderercontext(void)
+{
+    static const renderer_context defaults = RENDERER_CONTEXT_DEFAULTS;
+    renderer_context * context = malloc(sizeof(renderer_context));
+    if (context != NULL) {
+        *context = defaults;
+    }
+    return context;
+}
+
+void releaserenderercontext(renderer_context * * context)
+{
+    if (*context != NULL) {
+        releasescratcharena(&(*context)->scratch);
+        releasetrianglestreams(&(*context)->streams);
+        free(*context);
+        *context = NULL;
+    }
+}
 
 int geterror(void)
 {
-    return errornumber;
+    return geterror_ctx(&defaultcontext);
+}
+
+int geterror_ctx(const renderer_context * context)
+{
+    return context->errornumber;
 }
 
 const char * geterrortext(int number)
 {
-    if (number >= RENDERER_ERROR_NONE && number <= RENDERER_ERROR_CONFIGWRONGFORMAT) {
+    if (number >= RENDERER_ERROR_NONE && number <= RENDERER_ERROR_BINARYWRONGFORMAT) {
         return errortexts[number];
     } else {
         return NULL;
     }
 }
 
+size_t loadtriangles(const char * filename, triangles * rawtriangles)
+{
+    return loadtriangles_ctx(&defaultcontext, filename, rawtriangles);
+}
+
+size_t loadtriangles_ctx(renderer_context * context, const char * filename, triangles * rawtriangles)
+{
+    size_t length = strlen(filename);
+    if (length >= 7 && strcmp(filename + length - 7, ".rawbin") == 0) {
+        return loadbinarytriangles_ctx(context, filename, rawtriangles);
+    }
+
+    /* Prefer the binary cache next to a RAW file, if it was converted from the RAW file as it is now */
+    char * cachefilename = malloc(length + 8);
+    if (cachefilename == NULL) {
+        context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        return 0;
+    }
+    memcpy(cachefilename, filename, length + 1);
+    if (length >= 4 && strcmp(filename + length - 4, ".raw") == 0) {
+        strcat(cachefilename, "bin");
+    } else {
+        strcat(cachefilename, ".rawbin");
+    }
+    if (isfileuptodate(cachefilename, filename)) {
+        size_t size = loadbinarytriangles_ctx(context, cachefilename, rawtriangles);
+        if (context->errornumber == RENDERER_ERROR_NONE) {
+            free(cachefilename);
+            return size;
+        }
+    }
+    free(cachefilename);
+    return loadrawtriangles_ctx(context, filename, rawtriangles);
+}
+
 size_t loadrawtriangles(const char * filename, triangles * rawtriangles)
 {
-    char line[1024];
+    return loadrawtriangles_ctx(&defaultcontext, filename, rawtriangles);
+}
 
+size_t loadrawtriangles_ctx(renderer_context * context, const char * filename, triangles * rawtriangles)
+{
     if (rawtriangles->size != 0 || rawtriangles->data != NULL) {
-        errornumber = RENDERER_ERROR_INVALIDVALUE;
+        context->errornumber = RENDERER_ERROR_INVALIDVALUE;
         return 0;
     }
 
-    FILE * filepointer = fopen(filename, "r");
-    if (filepointer == NULL) {
-        errornumber = RENDERER_ERROR_FILEOPENFAILED;
+    tracezone loadzone;
+    begintracezone(&loadzone, "loadrawtriangles");
+
+    /* Taken before reading, a change made while the file is parsed leaves a stamp that no longer matches */
+    uint64_t sourcesize;
+    uint64_t sourcemodified;
+    if (!getfilestamp(filename, &sourcesize, &sourcemodified)) {
+        sourcesize = 0;
+        sourcemodified = 0;
+    }
+    mappedfile file;
+    if (!openmappedfile(&file, filename, false)) {
+        context->errornumber = RENDERER_ERROR_FILEOPENFAILED;
         return 0;
     }
 
-    for (;;) {
-        int c = fgetc(filepointer);
-        if (c == EOF) {
-            break;
-        } else if (c == '\n') {
-            continue;
-        } else {
-            size_t i;
-            line[0] = (char)c;
-            for (i = 1; i < 1024; i += 1) {
-                int c = fgetc(filepointer);
-                if (c == EOF || c == '\n') {
-                    line[i] = '\0';
-                    break;
-                } else {
-                    line[i] = (char)c;
-                }
-            }
-            if (i == 1024) {
-                releasetriangles(rawtriangles);
-                errornumber = RENDERER_ERROR_LINETOOLONG;
-                return 0;
+    /* Split the file at line boundaries, one chunk per thread */
+    size_t chunkcount = context->renderthreads == 0U ? getprocessorcount() : context->renderthreads;
+    if (chunkcount > file.size / RAW_CHUNK_MINIMUM_SIZE + 1) {
+        chunkcount = file.size / RAW_CHUNK_MINIMUM_SIZE + 1;
+    }
+    rawchunk * chunks = malloc(chunkcount * sizeof(rawchunk));
+    if (chunks == NULL) {
+        closemappedfile(&file);
+        context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        return 0;
+    }
+    const char * filestart = file.data;
+    const char * fileend = file.data + file.size;
+    const char * chunkstart = filestart;
+    for (size_t chunkindex = 0; chunkindex < chunkcount; chunkindex += 1) {
+        const char * chunkend = fileend;
+        if (chunkindex + 1 < chunkcount) {
+            chunkend = filestart + file.size / chunkcount * (chunkindex + 1);
+            if (chunkend < chunkstart) {
+                chunkend = chunkstart;
             }
+            const char * newline = memchr(chunkend, '\n', (size_t)(fileend - chunkend));
+            chunkend = newline == NULL ? fileend : newline + 1;
+        }
+        chunks[chunkindex].start = chunkstart;
+        chunks[chunkindex].end = chunkend;
+        chunks[chunkindex].loaded = 0;
+        chunks[chunkindex].linetoolong = false;
+        chunkstart = chunkend;
+    }
 
-            triangle newtriangle;
-            if (sscanf(line, "%f%f%f%f%f%f%f%f%f", &newtriangle.v1.x, &newtriangle.v1.y, &newtriangle.v1.z, &newtriangle.v2.x, &newtriangle.v2.y, &newtriangle.v2.z, &newtriangle.v3.x, &newtriangle.v3.y, &newtriangle.v3.z) != 9) {
-                continue;
-            }
-            newtriangle.w1 = 1.F;
-            newtriangle.w2 = 1.F;
-            newtriangle.w3 = 1.F;
-
-            rawtriangles->size += 1;
-            triangle * newrawtrianglesdata = realloc(rawtriangles->data, rawtriangles->size * sizeof(triangle));
-            if (newrawtrianglesdata == NULL) {
-                releasetriangles(rawtriangles);
-                fclose(filepointer);
-                errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-                return 0;
-            }
-            rawtriangles->data = newrawtrianglesdata;
-            rawtriangles->data[rawtriangles->size - 1] = newtriangle;
+    /* Count lines to size a single allocation, then parse every chunk into its own range */
+    runinparallel(countrawchunklines, chunks, sizeof(rawchunk), chunkcount);
+    size_t linecount = 0;
+    for (size_t chunkindex = 0; chunkindex < chunkcount; chunkindex += 1) {
+        chunks[chunkindex].offset = linecount;
+        linecount += chunks[chunkindex].linecount;
+    }
+    triangle * data = NULL;
+    if (linecount != 0) {
+        data = malloc(linecount * sizeof(triangle));
+        if (data == NULL) {
+            free(chunks);
+            closemappedfile(&file);
+            context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+            return 0;
         }
     }
+    for (size_t chunkindex = 0; chunkindex < chunkcount; chunkindex += 1) {
+        chunks[chunkindex].data = data;
+    }
+    runinparallel(parserawchunk, chunks, sizeof(rawchunk), chunkcount);
 
-    if (fclose(filepointer) == EOF) {
-        errornumber = RENDERER_ERROR_FILECLOSEFAILED;
-        if (rawtriangles->data != NULL) {
-            releasetriangles(rawtriangles);
+    /* Close the gaps left by blank and malformed lines */
+    size_t size = 0;
+    bool linetoolong = false;
+    for (size_t chunkindex = 0; chunkindex < chunkcount; chunkindex += 1) {
+        if (chunks[chunkindex].linetoolong) {
+            linetoolong = true;
+        }
+        if (size != chunks[chunkindex].offset && chunks[chunkindex].loaded != 0) {
+            memmove(&data[size], &data[chunks[chunkindex].offset], chunks[chunkindex].loaded * sizeof(triangle));
+        }
+        size += chunks[chunkindex].loaded;
+    }
+    free(chunks);
+    if (linetoolong) {
+        free(data);
+        closemappedfile(&file);
+        context->errornumber = RENDERER_ERROR_LINETOOLONG;
+        return 0;
+    }
+    if (size == 0) {
+        free(data);
+        data = NULL;
+    } else if (size < linecount) {
+        triangle * shrunkdata = realloc(data, size * sizeof(triangle));
+        if (shrunkdata != NULL) {
+            data = shrunkdata;
         }
+    }
+
+    if (!closemappedfile(&file)) {
+        free(data);
+        context->errornumber = RENDERER_ERROR_FILECLOSEFAILED;
+        return 0;
+    }
+
+    rawtriangles->size = size;
+    rawtriangles->data = data;
+    rawtriangles->mapping = NULL;
+    rawtriangles->sourcesize = sourcesize;
+    rawtriangles->sourcemodified = sourcemodified;
+    tracezone meshzone;
+    begintracezone(&meshzone, "build mesh");
+    rawtriangles->mesh = buildindexedmesh(rawtriangles);
+    if (rawtriangles->mesh == NULL) {
+        releasetriangles(rawtriangles);
+        context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        return 0;
+    }
+    endtracezone(&meshzone);
+    endtracezone(&loadzone);
+    context->errornumber = RENDERER_ERROR_NONE;
+    return rawtriangles->size;
+}
+
+size_t loadbinarytriangles(const char * filename, triangles * rawtriangles)
+{
+    return loadbinarytriangles_ctx(&defaultcontext, filename, rawtriangles);
+}
+
+size_t loadbinarytriangles_ctx(renderer_context * context, const char * filename, triangles * rawtriangles)
+{
+    if (rawtriangles->size != 0 || rawtriangles->data != NULL) {
+        context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        return 0;
+    }
+
+    tracezone loadzone;
+    begintracezone(&loadzone, "loadbinarytriangles");
+    mappedfile file;
+    if (!openmappedfile(&file, filename, true)) {
+        context->errornumber = RENDERER_ERROR_FILEOPENFAILED;
         return 0;
     }
 
-    errornumber = RENDERER_ERROR_NONE;
+    const binaryheader * header = (const binaryheader *)file.data;
+    if (file.size < sizeof(binaryheader) || !isbinaryheadervalid(header, file.size)) {
+        closemappedfile(&file);
+        context->errornumber = RENDERER_ERROR_BINARYWRONGFORMAT;
+        return 0;
+    }
+    size_t size = (size_t)header->size;
+    size_t dataoffset = (size_t)header->dataoffset;
+    binaryheader sections = *header;
+    const char * filedata = file.data;
+
+    triangle * data = NULL;
+    void * mapping = NULL;
+    if (size == 0) {
+        if (!closemappedfile(&file)) {
+            context->errornumber = RENDERER_ERROR_FILECLOSEFAILED;
+            return 0;
+        }
+    } else if (file.buffer != NULL) {
+        /* Files that cannot be mapped keep their buffer, moved down over the header */
+        memmove(file.buffer, file.buffer + dataoffset, size * sizeof(triangle));
+        data = (triangle *)file.buffer;
+    } else {
+        /* Use the triangles in place, the copy-on-write mapping stays until the triangles are released */
+#if defined(_WIN32)
+        bool closed = CloseHandle(file.mapping);
+        closed = CloseHandle(file.file) && closed;
+        if (!closed) {
+            UnmapViewOfFile(file.data);
+            context->errornumber = RENDERER_ERROR_FILECLOSEFAILED;
+            return 0;
+        }
+#endif
+        mapping = (void *)file.data;
+        data = (triangle *)(file.data + dataoffset);
+    }
+
+    rawtriangles->size = size;
+    rawtriangles->data = data;
+    rawtriangles->mapping = mapping;
+    rawtriangles->sourcesize = sections.sourcesize;
+    rawtriangles->sourcemodified = sections.sourcemodified;
+
+    /* The unique vertices, indices and hierarchy are used in place too, a buffered file only moved its triangles */
+    tracezone meshzone;
+    begintracezone(&meshzone, "validate mesh");
+    indexedmesh * mesh = size == 0 ? buildindexedmesh(rawtriangles) : malloc(sizeof(indexedmesh));
+    rawtriangles->mesh = mesh;
+    if (mesh == NULL) {
+        releasetriangles(rawtriangles);
+        context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        return 0;
+    }
+    if (size != 0) {
+        mesh->vertices.size = (size_t)sections.vertexcount;
+        mesh->vertices.x = (float *)(filedata + sections.vertexoffset);
+        mesh->vertices.y = mesh->vertices.x + mesh->vertices.size;
+        mesh->vertices.z = mesh->vertices.x + mesh->vertices.size * 2;
+        mesh->vertices.w = mesh->vertices.x + mesh->vertices.size * 3;
+        mesh->trianglecount = size;
+        mesh->indices = (uint32_t *)(filedata + sections.indexoffset);
+        mesh->nodecount = (size_t)sections.nodecount;
+        mesh->nodes = sections.nodecount != 0 ? (bvhnode *)(filedata + sections.nodeoffset) : NULL;
+        mesh->bvhtriangles = sections.nodecount != 0 ? (uint32_t *)(filedata + sections.bvhtriangleoffset) : NULL;
+        mesh->mapped = true;
+        if (!isindexedmeshvalid(mesh)) {
+            releasetriangles(rawtriangles);
+            context->errornumber = RENDERER_ERROR_BINARYWRONGFORMAT;
+            return 0;
+        }
+    }
+    endtracezone(&meshzone);
+    endtracezone(&loadzone);
+    context->errornumber = RENDERER_ERROR_NONE;
     return rawtriangles->size;
 }
 
+void savebinarytriangles(const triangles * rawtriangles, const char * filename)
+{
+    savebinarytriangles_ctx(&defaultcontext, rawtriangles, filename);
+}
+
+void savebinarytriangles_ctx(renderer_context * context, const triangles * rawtriangles, const char * filename)
+{
+    if (rawtriangles->size != 0 && rawtriangles->data == NULL) {
+        context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        return;
+    }
+
+    /* The indexed mesh is stored with the triangles so that loading the file does not build it again */
+    indexedmesh * temporarymesh = NULL;
+    const indexedmesh * mesh = rawtriangles->mesh;
+    if (mesh == NULL) {
+        temporarymesh = buildindexedmesh(rawtriangles);
+        if (temporarymesh == NULL) {
+            context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+            return;
+        }
+        mesh = temporarymesh;
+    }
+
+    FILE * filepointer = fopen(filename, "wb");
+    if (filepointer == NULL) {
+        releaseindexedmesh(temporarymesh);
+        context->errornumber = RENDERER_ERROR_FILEOPENFAILED;
+        return;
+    }
+
+    binaryheader header;
+    memset(&header, 0, sizeof header);
+    memcpy(header.magic, BINARY_MAGIC, sizeof header.magic);
+    header.version = BINARY_VERSION;
+    header.stride = sizeof(triangle);
+    header.size = rawtriangles->size;
+    header.dataoffset = alignbinaryoffset(sizeof(binaryheader));
+    header.sourcesize = rawtriangles->sourcesize;
+    header.sourcemodified = rawtriangles->sourcemodified;
+    header.vertexcount = mesh->vertices.size;
+    header.vertexoffset = alignbinaryoffset(header.dataoffset + header.size * sizeof(triangle));
+    header.indexoffset = alignbinaryoffset(header.vertexoffset + header.vertexcount * 4 * sizeof(float));
+    header.nodecount = mesh->nodecount;
+    header.nodeoffset = alignbinaryoffset(header.indexoffset + header.size * 3 * sizeof(uint32_t));
+    header.bvhtriangleoffset = alignbinaryoffset(header.nodeoffset + header.nodecount * sizeof(bvhnode));
+    size_t vertexsize = mesh->vertices.size * sizeof(float);
+    uint64_t position = 0;
+    bool written = writebinarysection(filepointer, &position, 0, &header, sizeof header) &&
+        writebinarysection(filepointer, &position, header.dataoffset, rawtriangles->data, rawtriangles->size * sizeof(triangle)) &&
+        writebinarysection(filepointer, &position, header.vertexoffset, mesh->vertices.x, vertexsize) &&
+        writebinarysection(filepointer, &position, position, mesh->vertices.y, vertexsize) &&
+        writebinarysection(filepointer, &position, position, mesh->vertices.z, vertexsize) &&
+        writebinarysection(filepointer, &position, position, mesh->vertices.w, vertexsize) &&
+        writebinarysection(filepointer, &position, header.indexoffset, mesh->indices, rawtriangles->size * 3 * sizeof(uint32_t)) &&
+        writebinarysection(filepointer, &position, header.nodeoffset, mesh->nodes, mesh->nodecount * sizeof(bvhnode)) &&
+        writebinarysection(filepointer, &position, header.bvhtriangleoffset, mesh->bvhtriangles, mesh->nodecount != 0 ? rawtriangles->size * sizeof(uint32_t) : 0);
+    releaseindexedmesh(temporarymesh);
+
+    if (fclose(filepointer) == EOF) {
+        context->errornumber = written ? RENDERER_ERROR_FILECLOSEFAILED : RENDERER_ERROR_FILEWRITEFAILED;
+        return;
+    }
+    if (!written) {
+        context->errornumber = RENDERER_ERROR_FILEWRITEFAILED;
+        return;
+    }
+
+    context->errornumber = RENDERER_ERROR_NONE;
+}
+
 void releasetriangles(triangles * rawtriangles)
 {
     rawtriangles->size = 0;
-    if (rawtriangles->data != NULL) {
+    if (rawtriangles->mesh != NULL) {
+        releaseindexedmesh(rawtriangles->mesh);
+        rawtriangles->mesh = NULL;
+    }
+    if (rawtriangles->mapping != NULL) {
+#if defined(_WIN32)
+        UnmapViewOfFile(rawtriangles->mapping);
+#else
+        const binaryheader * header = rawtriangles->mapping;
+        munmap(rawtriangles->mapping, (size_t)getbinaryfilesize(header));
+#endif
+        rawtriangles->mapping = NULL;
+    } else if (rawtriangles->data != NULL) {
         free(rawtriangles->data);
-        rawtriangles->data = NULL;
     }
+    rawtriangles->data = NULL;
+    rawtriangles->sourcesize = 0;
+    rawtriangles->sourcemodified = 0;
 }
 
 void readconfigurations(void)
 {
-    load_ini_path("renderer.ini", INI_DEFAULT_FORMAT, NULL, inicallback, NULL);
-    memset(inisection, 0, sizeof inisection);
-    if (errornumber == RENDERER_ERROR_NONE && znear >= zfar) {
-        errornumber = RENDERER_ERROR_INVALIDVALUE;
+    readconfigurations_ctx(&defaultcontext);
+}
+
+void readconfigurations_ctx(renderer_context * context)
+{
+    context->errornumber = RENDERER_ERROR_NONE;
+    load_ini_path("renderer.ini", INI_DEFAULT_FORMAT, NULL, inicallback, context);
+    memset(context->inisection, 0, sizeof context->inisection);
+    if (context->errornumber == RENDERER_ERROR_NONE && context->znear >= context->zfar) {
+        context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+    }
+}
+
+void setconfiguration(const char * key, const char * value)
+{
+    setconfiguration_ctx(&defaultcontext, key, value);
+}
+
+void setconfiguration_ctx(renderer_context * context, const char * key, const char * value)
+{
+    /* Takes the same keys and values as the Renderer section of renderer.ini */
+    context->errornumber = RENDERER_ERROR_NONE;
+    if (key == NULL || value == NULL || !applyconfiguration(context, key, value)) {
+        context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+    } else if (context->errornumber == RENDERER_ERROR_NONE && context->znear >= context->zfar) {
+        context->errornumber = RENDERER_ERROR_INVALIDVALUE;
     }
 }
 
 void getconfigurations(configurations * configstruct)
+{
+    getconfigurations_ctx(&defaultcontext, configstruct);
+}
+
+void getconfigurations_ctx(renderer_context * context, configurations * configstruct)
 {
     if (configstruct != NULL) {
-        configstruct->lightsourcepositionx = lightsourceposition.x;
-        configstruct->lightsourcepositiony = lightsourceposition.y;
-        configstruct->lightsourcepositionz = lightsourceposition.z;
-        configstruct->camerapositionx = cameraposition.x;
-        configstruct->camerapositiony = cameraposition.y;
-        configstruct->camerapositionz = cameraposition.z;
-        configstruct->cameralookatpointx = cameralookatpoint.x;
-        configstruct->cameralookatpointy = cameralookatpoint.y;
-        configstruct->cameralookatpointz = cameralookatpoint.z;
-        configstruct->upvectorx = up.x;
-        configstruct->upvectory = up.y;
-        configstruct->upvectorz = up.z;
-        configstruct->objectpositionx = objectposition.x;
-        configstruct->objectpositiony = objectposition.y;
-        configstruct->objectpositionz = objectposition.z;
-        configstruct->objectrotationx = objectrotationxdegree;
-        configstruct->objectrotationy = objectrotationydegree;
-        configstruct->objectrotationz = objectrotationzdegree;
-        configstruct->objectscalingx = objectscalingx;
-        configstruct->objectscalingy = objectscalingy;
-        configstruct->objectscalingz = objectscalingz;
-        configstruct->fieldofview = fieldofviewdegree;
-        configstruct->znear = znear;
-        configstruct->zfar = zfar;
-        configstruct->outputwidth = outputwidth;
-        configstruct->outputheight = outputheight;
-        configstruct->materialdiffusereflectancered = materialdiffusereflectancered;
-        configstruct->materialdiffusereflectancegreen = materialdiffusereflectancegreen;
-        configstruct->materialdiffusereflectanceblue = materialdiffusereflectanceblue;
-        configstruct->backfaceculling = backfaceculling ? 1 : 0;
-        configstruct->usezbuffer = usezbuffer ? 1 : 0;
-        errornumber = RENDERER_ERROR_NONE;
+        configstruct->lightsourcepositionx = context->lightsourceposition.x;
+        configstruct->lightsourcepositiony = context->lightsourceposition.y;
+        configstruct->lightsourcepositionz = context->lightsourceposition.z;
+        configstruct->camerapositionx = context->cameraposition.x;
+        configstruct->camerapositiony = context->cameraposition.y;
+        configstruct->camerapositionz = context->cameraposition.z;
+        configstruct->cameralookatpointx = context->cameralookatpoint.x;
+        configstruct->cameralookatpointy = context->cameralookatpoint.y;
+        configstruct->cameralookatpointz = context->cameralookatpoint.z;
+        configstruct->upvectorx = context->up.x;
+        configstruct->upvectory = context->up.y;
+        configstruct->upvectorz = context->up.z;
+        configstruct->objectpositionx = context->objectposition.x;
+        configstruct->objectpositiony = context->objectposition.y;
+        configstruct->objectpositionz = context->objectposition.z;
+        configstruct->objectrotationx = context->objectrotationxdegree;
+        configstruct->objectrotationy = context->objectrotationydegree;
+        configstruct->objectrotationz = context->objectrotationzdegree;
+        configstruct->objectscalingx = context->objectscalingx;
+        configstruct->objectscalingy = context->objectscalingy;
+        configstruct->objectscalingz = context->objectscalingz;
+        configstruct->fieldofview = context->fieldofviewdegree;
+        configstruct->znear = context->znear;
+        configstruct->zfar = context->zfar;
+        configstruct->outputwidth = context->outputwidth;
+        configstruct->outputheight = context->outputheight;
+        configstruct->materialdiffusereflectancered = context->materialdiffusereflectancered;
+        configstruct->materialdiffusereflectancegreen = context->materialdiffusereflectancegreen;
+        configstruct->materialdiffusereflectanceblue = context->materialdiffusereflectanceblue;
+        configstruct->backfaceculling = context->backfaceculling ? 1 : 0;
+        configstruct->usezbuffer = context->usezbuffer ? 1 : 0;
+        configstruct->fronttobacksort = context->fronttobacksort ? 1 : 0;
+        configstruct->renderthreads = context->renderthreads;
+        configstruct->antialiasing = context->antialiasing;
+        configstruct->pngcompressionlevel = context->pngcompressionlevel;
+        configstruct->pngfilter = context->pngfilter;
+        configstruct->pngparalleldeflate = context->pngparalleldeflate ? 1 : 0;
+        configstruct->outputformat = context->outputformat;
+        context->errornumber = RENDERER_ERROR_NONE;
     } else {
-        errornumber = RENDERER_ERROR_INVALIDVALUE;
+        context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+    }
+}
+
+void setconfigurations(const configurations * configstruct)
+{
+    setconfigurations_ctx(&defaultcontext, configstruct);
+}
+
+void setconfigurations_ctx(renderer_context * context, const configurations * configstruct)
+{
+    /* Nothing changes unless every value is valid */
+    if (configstruct == NULL || configstruct->fieldofview < 0.F || configstruct->fieldofview > 180.F || configstruct->znear < FLT_EPSILON || configstruct->zfar < FLT_EPSILON || configstruct->znear >= configstruct->zfar ||
+        configstruct->outputwidth == 0U || configstruct->outputwidth > 32767U || configstruct->outputheight == 0U || configstruct->outputheight > 32767U ||
+        configstruct->materialdiffusereflectancered < 0 || configstruct->materialdiffusereflectancered > 255 || configstruct->materialdiffusereflectancegreen < 0 || configstruct->materialdiffusereflectancegreen > 255 ||
+        configstruct->materialdiffusereflectanceblue < 0 || configstruct->materialdiffusereflectanceblue > 255 || configstruct->renderthreads > 256U ||
+        configstruct->antialiasing == 0U || configstruct->antialiasing > 4U ||
+        configstruct->pngcompressionlevel < 0 || configstruct->pngcompressionlevel > 9 || configstruct->pngfilter < RENDERER_PNG_FILTER_NONE || configstruct->pngfilter > RENDERER_PNG_FILTER_ADAPTIVE ||
+        configstruct->outputformat < RENDERER_OUTPUT_FORMAT_AUTO || configstruct->outputformat > RENDERER_OUTPUT_FORMAT_RAW) {
+        context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        return;
     }
+    context->lightsourceposition.x = configstruct->lightsourcepositionx;
+    context->lightsourceposition.y = configstruct->lightsourcepositiony;
+    context->lightsourceposition.z = configstruct->lightsourcepositionz;
+    context->cameraposition.x = configstruct->camerapositionx;
+    context->cameraposition.y = configstruct->camerapositiony;
+    context->cameraposition.z = configstruct->camerapositionz;
+    context->cameralookatpoint.x = configstruct->cameralookatpointx;
+    context->cameralookatpoint.y = configstruct->cameralookatpointy;
+    context->cameralookatpoint.z = configstruct->cameralookatpointz;
+    context->up.x = configstruct->upvectorx;
+    context->up.y = configstruct->upvectory;
+    context->up.z = configstruct->upvectorz;
+    context->objectposition.x = configstruct->objectpositionx;
+    context->objectposition.y = configstruct->objectpositiony;
+    context->objectposition.z = configstruct->objectpositionz;
+    context->objectrotationxdegree = configstruct->objectrotationx;
+    context->objectrotationydegree = configstruct->objectrotationy;
+    context->objectrotationzdegree = configstruct->objectrotationz;
+    context->objectrotationx = degreetoradian(configstruct->objectrotationx);
+    context->objectrotationy = degreetoradian(configstruct->objectrotationy);
+    context->objectrotationz = degreetoradian(configstruct->objectrotationz);
+    context->objectscalingx = configstruct->objectscalingx;
+    context->objectscalingy = configstruct->objectscalingy;
+    context->objectscalingz = configstruct->objectscalingz;
+    context->fieldofviewdegree = configstruct->fieldofview;
+    context->fieldofview = degreetoradian(configstruct->fieldofview);
+    context->znear = configstruct->znear;
+    context->zfar = configstruct->zfar;
+    context->outputwidth = configstruct->outputwidth;
+    context->outputheight = configstruct->outputheight;
+    context->materialdiffusereflectancered = configstruct->materialdiffusereflectancered;
+    context->materialdiffusereflectancegreen = configstruct->materialdiffusereflectancegreen;
+    context->materialdiffusereflectanceblue = configstruct->materialdiffusereflectanceblue;
+    context->materialdiffusereflectance.red = configstruct->materialdiffusereflectancered / 255.0F;
+    context->materialdiffusereflectance.green = configstruct->materialdiffusereflectancegreen / 255.0F;
+    context->materialdiffusereflectance.blue = configstruct->materialdiffusereflectanceblue / 255.0F;
+    context->backfaceculling = configstruct->backfaceculling != 0;
+    context->usezbuffer = configstruct->usezbuffer != 0;
+    context->fronttobacksort = configstruct->fronttobacksort != 0;
+    context->renderthreads = configstruct->renderthreads;
+    context->antialiasing = configstruct->antialiasing;
+    context->pngcompressionlevel = configstruct->pngcompressionlevel;
+    context->pngfilter = configstruct->pngfilter;
+    context->pngparalleldeflate = configstruct->pngparalleldeflate != 0;
+    context->outputformat = configstruct->outputformat;
+    context->errornumber = RENDERER_ERROR_NONE;
 }
 
 surface * createsurface(uint16_t width, uint16_t height)
+{
+    return createsurface_ctx(&defaultcontext, width, height);
+}
+
+surface * createsurface_ctx(renderer_context * context, uint16_t width, uint16_t height)
 {
     surface * newsurface = malloc(sizeof(surface) + ((size_t)width * (size_t)height - 1) * sizeof(uint32_t));
     if (newsurface == NULL) {
-        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
         return NULL;
     }
     newsurface->width = (uint16_t)width;
     newsurface->height = (uint16_t)height;
     memset(newsurface->pixels, 0, (size_t)newsurface->width * (size_t)newsurface->height * sizeof(uint32_t));
-    errornumber = RENDERER_ERROR_NONE;
+    context->errornumber = RENDERER_ERROR_NONE;
     return newsurface;
 }
 
 surface * createrendertarget(void)
 {
-    return createsurface(outputwidth, outputheight);
+    return createrendertarget_ctx(&defaultcontext);
+}
+
+surface * createrendertarget_ctx(renderer_context * context)
+{
+    return createsurface_ctx(context, (uint16_t)context->outputwidth, (uint16_t)context->outputheight);
 }
 
 void releasesurface(surface * * s)
@@ -280,89 +1240,49 @@ void releasesurface(surface * * s)
 }
 
 void rendersurface(const triangles * rawtriangles, surface * target)
+{
+    rendersurface_ctx(&defaultcontext, rawtriangles, target);
+}
+
+void rendersurface_ctx(renderer_context * context, const triangles * rawtriangles, surface * target)
 {
     /* Clear render target surface */
     memset(target->pixels, 0, (size_t)target->width * (size_t)target->height * sizeof(uint32_t));
 
-    triangles transformedtriangles;
-    transformedtriangles.size = 0;
-    transformedtriangles.data = malloc(rawtriangles->size * sizeof(triangle));
-    if (transformedtriangles.data == NULL) {
-        releasetriangles(&transformedtriangles);
-        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-        return;
-    }
+    /* Everything allocated from the scratch arena lives until the next frame */
+    scratcharena * scratch = &context->scratch;
+    resetscratcharena(scratch);
+    renderer_stats * stats = &context->stats;
+    memset(stats, 0, sizeof(renderer_stats));
+    tracezone framezone;
+    begintracezone(&framezone, "rendersurface");
 
-    /* Model-space backface culling */
-    point modelspacecameraposition;
-    point intermediatepoint;
-    float sinthetax = sinf(objectrotationx);
-    float costhetax = cosf(objectrotationx);
-    float sinthetay = sinf(objectrotationy);
-    float costhetay = cosf(objectrotationy);
-    float sinthetaz = sinf(objectrotationz);
-    float costhetaz = cosf(objectrotationz);
-    void * reallocpointer = NULL;
-    if (backfaceculling) {
-        intermediatepoint.x = cameraposition.x - objectposition.x;
-        intermediatepoint.y = cameraposition.y - objectposition.y;
-        intermediatepoint.z = cameraposition.z - objectposition.z;
-        modelspacecameraposition.x = costhetaz * intermediatepoint.x + sinthetaz * intermediatepoint.y;
-        modelspacecameraposition.y = -sinthetaz * intermediatepoint.x + costhetaz * intermediatepoint.y;
-        modelspacecameraposition.z = intermediatepoint.z;
-        intermediatepoint.x = costhetay * modelspacecameraposition.x + -sinthetay * modelspacecameraposition.z;
-        intermediatepoint.y = modelspacecameraposition.y;
-        intermediatepoint.z = sinthetay * modelspacecameraposition.x + costhetay * modelspacecameraposition.z;
-        modelspacecameraposition.x = intermediatepoint.x / objectscalingx;
-        modelspacecameraposition.y = (costhetax * intermediatepoint.y + sinthetax * intermediatepoint.z) / objectscalingy;
-        modelspacecameraposition.z = (-sinthetax * intermediatepoint.y + costhetax * intermediatepoint.z) / objectscalingz;
-        for (size_t triangleindex = 0; triangleindex < rawtriangles->size; triangleindex += 1) {
-            vector v1 = {
-                rawtriangles->data[triangleindex].v2.x - rawtriangles->data[triangleindex].v1.x,
-                rawtriangles->data[triangleindex].v2.y - rawtriangles->data[triangleindex].v1.y,
-                rawtriangles->data[triangleindex].v2.z - rawtriangles->data[triangleindex].v1.z
-            };
-            vector v2 = {
-                rawtriangles->data[triangleindex].v3.x - rawtriangles->data[triangleindex].v1.x,
-                rawtriangles->data[triangleindex].v3.y - rawtriangles->data[triangleindex].v1.y,
-                rawtriangles->data[triangleindex].v3.z - rawtriangles->data[triangleindex].v1.z
-            };
-            vector surfacevector;
-            crossproduct(&surfacevector, &v1, &v2);
-            vector eyevector = {
-                modelspacecameraposition.x - (rawtriangles->data[triangleindex].v1.x + rawtriangles->data[triangleindex].v2.x + rawtriangles->data[triangleindex].v3.x) / 3.F,
-                modelspacecameraposition.y - (rawtriangles->data[triangleindex].v1.y + rawtriangles->data[triangleindex].v2.y + rawtriangles->data[triangleindex].v3.y) / 3.F,
-                modelspacecameraposition.z - (rawtriangles->data[triangleindex].v1.z + rawtriangles->data[triangleindex].v2.z + rawtriangles->data[triangleindex].v3.z) / 3.F
-            };
-            if (dotproduct(&surfacevector, &eyevector) > FLT_EPSILON) {
-                transformedtriangles.data[transformedtriangles.size] = rawtriangles->data[triangleindex];
-                transformedtriangles.size += 1;
-            }
-        }
-        if (transformedtriangles.size == 0) {
-            releasetriangles(&transformedtriangles);
-            return;
-        }
-        reallocpointer = realloc(transformedtriangles.data, transformedtriangles.size * sizeof(triangle));
-        if (reallocpointer == NULL) {
-            releasetriangles(&transformedtriangles);
-            errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+    /* Triangles not filled in by a loader have no indexed mesh yet */
+    const indexedmesh * mesh = rawtriangles->mesh;
+    indexedmesh * temporarymesh = NULL;
+    if (mesh == NULL) {
+        temporarymesh = buildindexedmesh(rawtriangles);
+        if (temporarymesh == NULL) {
+            context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
             return;
         }
-        transformedtriangles.data = reallocpointer;
-    } else {
-        transformedtriangles.size = rawtriangles->size;
-        memcpy(transformedtriangles.data, rawtriangles->data, rawtriangles->size * sizeof(triangle));
+        mesh = temporarymesh;
     }
 
+    float sinthetax = sinf(context->objectrotationx);
+    float costhetax = cosf(context->objectrotationx);
+    float sinthetay = sinf(context->objectrotationy);
+    float costhetay = cosf(context->objectrotationy);
+    float sinthetaz = sinf(context->objectrotationz);
+    float costhetaz = cosf(context->objectrotationz);
     float transformationmatrix[16];
     memcpy(transformationmatrix, identitymatrix, sizeof identitymatrix);
     float operatormatrix[16];
 
     /* Scaling */
-    transformationmatrix[0] = objectscalingx;
-    transformationmatrix[5] = objectscalingy;
-    transformationmatrix[10] = objectscalingz;
+    transformationmatrix[0] = context->objectscalingx;
+    transformationmatrix[5] = context->objectscalingy;
+    transformationmatrix[10] = context->objectscalingz;
 
     /* Rotation along X axis */
     operatormatrix[0] = 1.F;
@@ -434,17 +1354,17 @@ void rendersurface(const triangles * rawtriangles, surface * target)
     operatormatrix[9] = 0.F;
     operatormatrix[10] = 1.F;
     operatormatrix[11] = 0.F;
-    operatormatrix[12] = objectposition.x;
-    operatormatrix[13] = objectposition.y;
-    operatormatrix[14] = objectposition.z;
+    operatormatrix[12] = context->objectposition.x;
+    operatormatrix[13] = context->objectposition.y;
+    operatormatrix[14] = context->objectposition.z;
     operatormatrix[15] = 1.F;
     calculatenewtransformationmatrix(transformationmatrix, operatormatrix);
 
     /* View transformation matrix */
-    vector zaxis = {cameralookatpoint.x - cameraposition.x, cameralookatpoint.y - cameraposition.y, cameralookatpoint.z - cameraposition.z};
+    vector zaxis = {context->cameralookatpoint.x - context->cameraposition.x, context->cameralookatpoint.y - context->cameraposition.y, context->cameralookatpoint.z - context->cameraposition.z};
     normalize(&zaxis);
     vector xaxis;
-    crossproduct(&xaxis, &up, &zaxis);
+    crossproduct(&xaxis, &context->up, &zaxis);
     normalize(&xaxis);
     vector yaxis;
     crossproduct(&yaxis, &zaxis, &xaxis);
@@ -460,920 +1380,1290 @@ void rendersurface(const triangles * rawtriangles, surface * target)
     operatormatrix[9] = yaxis.z;
     operatormatrix[10] = zaxis.z;
     operatormatrix[11] = 0.F;
-    operatormatrix[12] = -dotproduct(&xaxis, (const vector *)&cameraposition);
-    operatormatrix[13] = -dotproduct(&yaxis, (const vector *)&cameraposition);
-    operatormatrix[14] = -dotproduct(&zaxis, (const vector *)&cameraposition);
+    operatormatrix[12] = -dotproduct(&xaxis, (const vector *)&context->cameraposition);
+    operatormatrix[13] = -dotproduct(&yaxis, (const vector *)&context->cameraposition);
+    operatormatrix[14] = -dotproduct(&zaxis, (const vector *)&context->cameraposition);
     operatormatrix[15] = 1.F;
     calculatenewtransformationmatrix(transformationmatrix, operatormatrix);
 
-    /* Model-view transformation */
-    triangle * newdata = malloc(transformedtriangles.size * sizeof(triangle));
-    if (newdata == NULL) {
-        releasetriangles(&transformedtriangles);
-        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-        return;
-    }
-    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, (int)transformedtriangles.size * 3, 4, 4, 1.F, (float *)transformedtriangles.data, 4, transformationmatrix, 4, 0.F, (float *)newdata, 4);
-    triangle * temp = transformedtriangles.data;
-    transformedtriangles.data = newdata;
-    newdata = temp;
-
     /* Calculate view-space position of light source */
     point viewspacelightsourceposition = {
-        operatormatrix[0] * lightsourceposition.x + operatormatrix[4] * lightsourceposition.y + operatormatrix[8] * lightsourceposition.z + operatormatrix[12],
-        operatormatrix[1] * lightsourceposition.x + operatormatrix[5] * lightsourceposition.y + operatormatrix[9] * lightsourceposition.z + operatormatrix[13],
-        operatormatrix[2] * lightsourceposition.x + operatormatrix[6] * lightsourceposition.y + operatormatrix[10] * lightsourceposition.z + operatormatrix[14]
+        operatormatrix[0] * context->lightsourceposition.x + operatormatrix[4] * context->lightsourceposition.y + operatormatrix[8] * context->lightsourceposition.z + operatormatrix[12],
+        operatormatrix[1] * context->lightsourceposition.x + operatormatrix[5] * context->lightsourceposition.y + operatormatrix[9] * context->lightsourceposition.z + operatormatrix[13],
+        operatormatrix[2] * context->lightsourceposition.x + operatormatrix[6] * context->lightsourceposition.y + operatormatrix[10] * context->lightsourceposition.z + operatormatrix[14]
     };
 
-    /* Create lighting table */
-    light * lightingtable = malloc(transformedtriangles.size * sizeof(light));
-    if (lightingtable == NULL) {
-        free(newdata);
-        releasetriangles(&transformedtriangles);
-        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-        return;
-    }
+    /* Perspective projection */
+    float projectionmatrix[16];
+    float aspectratio = (float)target->width / (float)target->height;
+    float yscale = 1.0F / tanf(context->fieldofview / 2.F);
+    projectionmatrix[0] = yscale / aspectratio;
+    projectionmatrix[1] = 0.F;
+    projectionmatrix[2] = 0.F;
+    projectionmatrix[3] = 0.F;
+    projectionmatrix[4] = 0.F;
+    projectionmatrix[5] = yscale;
+    projectionmatrix[6] = 0.F;
+    projectionmatrix[7] = 0.F;
+    projectionmatrix[8] = 0.F;
+    projectionmatrix[9] = 0.F;
+    projectionmatrix[10] = context->zfar / (context->zfar - context->znear);
+    projectionmatrix[11] = 1.F;
+    projectionmatrix[12] = 0.F;
+    projectionmatrix[13] = 0.F;
+    projectionmatrix[14] = -context->znear * context->zfar / (context->zfar - context->znear);
+    projectionmatrix[15] = 0.F;
 
-    /* Calculate lighting */
-    for (size_t triangleindex = 0; triangleindex < transformedtriangles.size; triangleindex += 1) {
-        vector v1 = {
-            transformedtriangles.data[triangleindex].v2.x - transformedtriangles.data[triangleindex].v1.x,
-            transformedtriangles.data[triangleindex].v2.y - transformedtriangles.data[triangleindex].v1.y,
-            transformedtriangles.data[triangleindex].v2.z - transformedtriangles.data[triangleindex].v1.z
-        };
-        vector v2 = {
-            transformedtriangles.data[triangleindex].v3.x - transformedtriangles.data[triangleindex].v1.x,
-            transformedtriangles.data[triangleindex].v3.y - transformedtriangles.data[triangleindex].v1.y,
-            transformedtriangles.data[triangleindex].v3.z - transformedtriangles.data[triangleindex].v1.z
-        };
-        vector normalvector;
-        crossproduct(&normalvector, &v1, &v2);
-        normalize(&normalvector);
-        vector lightvector = {
-            viewspacelightsourceposition.x - (transformedtriangles.data[triangleindex].v1.x + transformedtriangles.data[triangleindex].v2.x + transformedtriangles.data[triangleindex].v3.x) / 3.F,
-            viewspacelightsourceposition.y - (transformedtriangles.data[triangleindex].v1.y + transformedtriangles.data[triangleindex].v2.y + transformedtriangles.data[triangleindex].v3.y) / 3.F,
-            viewspacelightsourceposition.z - (transformedtriangles.data[triangleindex].v1.z + transformedtriangles.data[triangleindex].v2.z + transformedtriangles.data[triangleindex].v3.z) / 3.F
-        };
-        normalize(&lightvector);
-        float lambertiancosine = fmaxf(0.F, dotproduct(&normalvector, &lightvector));
-        lightingtable[triangleindex].red = materialdiffusereflectance.red * lambertiancosine;
-        lightingtable[triangleindex].green = materialdiffusereflectance.green * lambertiancosine;
-        lightingtable[triangleindex].blue = materialdiffusereflectance.blue * lambertiancosine;
-    }
-
-    /* Perspective projection */
-    float aspectratio = (float)target->width / (float)target->height;
-    float yscale = 1.0F / tanf(fieldofview / 2.F);
-    transformationmatrix[0] = yscale / aspectratio;
-    transformationmatrix[1] = 0.F;
-    transformationmatrix[2] = 0.F;
-    transformationmatrix[3] = 0.F;
-    transformationmatrix[4] = 0.F;
-    transformationmatrix[5] = yscale;
-    transformationmatrix[6] = 0.F;
-    transformationmatrix[7] = 0.F;
-    transformationmatrix[8] = 0.F;
-    transformationmatrix[9] = 0.F;
-    transformationmatrix[10] = zfar / (zfar - znear);
-    transformationmatrix[11] = 1.F;
-    transformationmatrix[12] = 0.F;
-    transformationmatrix[13] = 0.F;
-    transformationmatrix[14] = -znear * zfar / (zfar - znear);
-    transformationmatrix[15] = 0.F;
-    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, (int)transformedtriangles.size * 3, 4, 4, 1.F, (float *)transformedtriangles.data, 4, transformationmatrix, 4, 0.F, (float *)newdata, 4);
-    temp = transformedtriangles.data;
-    transformedtriangles.data = newdata;
-    newdata = temp;
-
-    light * newlightingtable = malloc(transformedtriangles.size * sizeof(light));
-    if (newlightingtable == NULL) {
-        free(lightingtable);
-        free(newdata);
-        releasetriangles(&transformedtriangles);
-        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-        return;
-    }
-
-    /* Perspective divide and clipping */
-    size_t newsize = 0;
-    for (size_t triangleindex = 0; triangleindex < transformedtriangles.size; triangleindex += 1) {
-        if (transformedtriangles.data[triangleindex].w1 > 0.F && transformedtriangles.data[triangleindex].w2 > 0.F && transformedtriangles.data[triangleindex].w3 > 0.F) {
-            if (transformedtriangles.data[triangleindex].v1.x >= -transformedtriangles.data[triangleindex].w1 && transformedtriangles.data[triangleindex].v1.x <= transformedtriangles.data[triangleindex].w1 && transformedtriangles.data[triangleindex].v1.y >= -transformedtriangles.data[triangleindex].w1 && transformedtriangles.data[triangleindex].v1.y <= transformedtriangles.data[triangleindex].w1 && transformedtriangles.data[triangleindex].v1.z >= 0.F && transformedtriangles.data[triangleindex].v1.z <= transformedtriangles.data[triangleindex].w1 &&
-                transformedtriangles.data[triangleindex].v2.x >= -transformedtriangles.data[triangleindex].w2 && transformedtriangles.data[triangleindex].v2.x <= transformedtriangles.data[triangleindex].w2 && transformedtriangles.data[triangleindex].v2.y >= -transformedtriangles.data[triangleindex].w2 && transformedtriangles.data[triangleindex].v2.y <= transformedtriangles.data[triangleindex].w2 && transformedtriangles.data[triangleindex].v2.z >= 0.F && transformedtriangles.data[triangleindex].v2.z <= transformedtriangles.data[triangleindex].w2 &&
-                transformedtriangles.data[triangleindex].v3.x >= -transformedtriangles.data[triangleindex].w3 && transformedtriangles.data[triangleindex].v3.x <= transformedtriangles.data[triangleindex].w3 && transformedtriangles.data[triangleindex].v3.y >= -transformedtriangles.data[triangleindex].w3 && transformedtriangles.data[triangleindex].v3.y <= transformedtriangles.data[triangleindex].w3 && transformedtriangles.data[triangleindex].v3.z >= 0.F && transformedtriangles.data[triangleindex].v3.z <= transformedtriangles.data[triangleindex].w3) {
-                if (newsize + 1 > transformedtriangles.size) {
-                    reallocpointer = realloc(newdata, (newsize + 1) * sizeof(triangle));
-                    if (reallocpointer == NULL) {
-                        free(newlightingtable);
-                        free(lightingtable);
-                        free(newdata);
-                        releasetriangles(&transformedtriangles);
-                        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-                        return;
-                    }
-                    newdata = reallocpointer;
-                    reallocpointer = realloc(newlightingtable, (newsize + 1) * sizeof(light));
-                    if (reallocpointer == NULL) {
-                        free(newlightingtable);
-                        free(lightingtable);
-                        free(newdata);
-                        releasetriangles(&transformedtriangles);
-                        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-                        return;
-                    }
-                    newlightingtable = reallocpointer;
-                }
-                newdata[newsize].v1.x = transformedtriangles.data[triangleindex].v1.x / transformedtriangles.data[triangleindex].w1;
-                newdata[newsize].v1.y = transformedtriangles.data[triangleindex].v1.y / transformedtriangles.data[triangleindex].w1;
-                newdata[newsize].v1.z = transformedtriangles.data[triangleindex].v1.z / transformedtriangles.data[triangleindex].w1;
-                newdata[newsize].w1 = 1.F;
-                newdata[newsize].v2.x = transformedtriangles.data[triangleindex].v2.x / transformedtriangles.data[triangleindex].w2;
-                newdata[newsize].v2.y = transformedtriangles.data[triangleindex].v2.y / transformedtriangles.data[triangleindex].w2;
-                newdata[newsize].v2.z = transformedtriangles.data[triangleindex].v2.z / transformedtriangles.data[triangleindex].w2;
-                newdata[newsize].w2 = 1.F;
-                newdata[newsize].v3.x = transformedtriangles.data[triangleindex].v3.x / transformedtriangles.data[triangleindex].w3;
-                newdata[newsize].v3.y = transformedtriangles.data[triangleindex].v3.y / transformedtriangles.data[triangleindex].w3;
-                newdata[newsize].v3.z = transformedtriangles.data[triangleindex].v3.z / transformedtriangles.data[triangleindex].w3;
-                newdata[newsize].w3 = 1.F;
-                newlightingtable[newsize].red = lightingtable[triangleindex].red;
-                newlightingtable[newsize].green = lightingtable[triangleindex].green;
-                newlightingtable[newsize].blue = lightingtable[triangleindex].blue;
-                newsize += 1;
-            } else {
-                polygon p1 = {
-                    3,
-                    {
-                        {transformedtriangles.data[triangleindex].v1.x / transformedtriangles.data[triangleindex].w1, transformedtriangles.data[triangleindex].v1.y / transformedtriangles.data[triangleindex].w1, transformedtriangles.data[triangleindex].v1.z / transformedtriangles.data[triangleindex].w1},
-                        {transformedtriangles.data[triangleindex].v2.x / transformedtriangles.data[triangleindex].w2, transformedtriangles.data[triangleindex].v2.y / transformedtriangles.data[triangleindex].w2, transformedtriangles.data[triangleindex].v2.z / transformedtriangles.data[triangleindex].w2},
-                        {transformedtriangles.data[triangleindex].v3.x / transformedtriangles.data[triangleindex].w3, transformedtriangles.data[triangleindex].v3.y / transformedtriangles.data[triangleindex].w3, transformedtriangles.data[triangleindex].v3.z / transformedtriangles.data[triangleindex].w3}
-                    }
-                };
-                polygon p2;
-                bool inside;
-                bool nextinside;
-                point previous;
-
-                /* Check p1 against x >= -1 and save clipped polygon in p2 */
-                p2.size = 0;
-                inside = p1.vertices[0].x >= -1.F;
-                if (inside) {
-                    p2.vertices[p2.size] = p1.vertices[0];
-                    p2.size += 1;
-                }
-                previous = p1.vertices[0];
-                for (size_t vertexindex = 1; vertexindex < p1.size; vertexindex += 1) {
-                    nextinside = p1.vertices[vertexindex].x >= -1.F;
-                    if ((inside && !nextinside) || (!inside && nextinside)) {
-                        /* Append intersection point to p2 */
-                        float ratio = (-1.F - previous.x) / (p1.vertices[vertexindex].x - previous.x);
-                        p2.vertices[p2.size].x = -1.F;
-                        p2.vertices[p2.size].y = previous.y + (p1.vertices[vertexindex].y - previous.y) * ratio;
-                        p2.vertices[p2.size].z = previous.z + (p1.vertices[vertexindex].z - previous.z) * ratio;
-                        p2.size += 1;
-                    }
-                    if (nextinside) {
-                        p2.vertices[p2.size] = p1.vertices[vertexindex];
-                        p2.size += 1;
-                    }
-                    inside = nextinside;
-                    previous = p1.vertices[vertexindex];
-                }
-                nextinside = p1.vertices[0].x >= -1.F;
-                if ((inside && !nextinside) || (!inside && nextinside)) {
-                    /* Append intersection point to p2 */
-                    float ratio = (-1.F - previous.x) / (p1.vertices[0].x - previous.x);
-                    p2.vertices[p2.size].x = -1.F;
-                    p2.vertices[p2.size].y = previous.y + (p1.vertices[0].y - previous.y) * ratio;
-                    p2.vertices[p2.size].z = previous.z + (p1.vertices[0].z - previous.z) * ratio;
-                    p2.size += 1;
-                }
-                if (p2.size < 3) {
-                    continue;
-                }
-
-                /* Check p2 against x <= 1 and save clipped polygon in p1 */
-                p1.size = 0;
-                inside = p2.vertices[0].x <= 1.F;
-                if (inside) {
-                    p1.vertices[p1.size] = p2.vertices[0];
-                    p1.size += 1;
-                }
-                previous = p2.vertices[0];
-                for (size_t vertexindex = 1; vertexindex < p2.size; vertexindex += 1) {
-                    nextinside = p2.vertices[vertexindex].x <= 1.F;
-                    if ((inside && !nextinside) || (!inside && nextinside)) {
-                        /* Append intersection point to p1 */
-                        float ratio = (1.F - previous.x) / (p2.vertices[vertexindex].x - previous.x);
-                        p1.vertices[p1.size].x = 1.F;
-                        p1.vertices[p1.size].y = previous.y + (p2.vertices[vertexindex].y - previous.y) * ratio;
-                        p1.vertices[p1.size].z = previous.z + (p2.vertices[vertexindex].z - previous.z) * ratio;
-                        p1.size += 1;
-                    }
-                    if (nextinside) {
-                        p1.vertices[p1.size] = p2.vertices[vertexindex];
-                        p1.size += 1;
-                    }
-                    inside = nextinside;
-                    previous = p2.vertices[vertexindex];
-                }
-                nextinside = p2.vertices[0].x <= 1.F;
-                if ((inside && !nextinside) || (!inside && nextinside)) {
-                    /* Append intersection point to p1 */
-                    float ratio = (1.F - previous.x) / (p2.vertices[0].x - previous.x);
-                    p1.vertices[p1.size].x = 1.F;
-                    p1.vertices[p1.size].y = previous.y + (p2.vertices[0].y - previous.y) * ratio;
-                    p1.vertices[p1.size].z = previous.z + (p2.vertices[0].z - previous.z) * ratio;
-                    p1.size += 1;
-                }
-                if (p1.size < 3) {
-                    continue;
-                }
-
-                /* Check p1 against y >= -1 and save clipped polygon in p2 */
-                p2.size = 0;
-                inside = p1.vertices[0].y >= -1.F;
-                if (inside) {
-                    p2.vertices[p2.size] = p1.vertices[0];
-                    p2.size += 1;
-                }
-                previous = p1.vertices[0];
-                for (size_t vertexindex = 1; vertexindex < p1.size; vertexindex += 1) {
-                    nextinside = p1.vertices[vertexindex].y >= -1.F;
-                    if ((inside && !nextinside) || (!inside && nextinside)) {
-                        /* Append intersection point to p2 */
-                        float ratio = (-1.F - previous.y) / (p1.vertices[vertexindex].y - previous.y);
-                        p2.vertices[p2.size].x = previous.x + (p1.vertices[vertexindex].x - previous.x) * ratio;
-                        p2.vertices[p2.size].y = -1.F;
-                        p2.vertices[p2.size].z = previous.z + (p1.vertices[vertexindex].z - previous.z) * ratio;
-                        p2.size += 1;
-                    }
-                    if (nextinside) {
-                        p2.vertices[p2.size] = p1.vertices[vertexindex];
-                        p2.size += 1;
-                    }
-                    inside = nextinside;
-                    previous = p1.vertices[vertexindex];
-                }
-                nextinside = p1.vertices[0].y >= -1.F;
-                if ((inside && !nextinside) || (!inside && nextinside)) {
-                    /* Append intersection point to p2 */
-                    float ratio = (-1.F - previous.y) / (p1.vertices[0].y - previous.y);
-                    p2.vertices[p2.size].x = previous.x + (p1.vertices[0].x - previous.x) * ratio;
-                    p2.vertices[p2.size].y = -1.F;
-                    p2.vertices[p2.size].z = previous.z + (p1.vertices[0].z - previous.z) * ratio;
-                    p2.size += 1;
-                }
-                if (p2.size < 3) {
-                    continue;
-                }
-
-                /* Check p2 against y <= 1 and save clipped polygon in p1 */
-                p1.size = 0;
-                inside = p2.vertices[0].y <= 1.F;
-                if (inside) {
-                    p1.vertices[p1.size] = p2.vertices[0];
-                    p1.size += 1;
-                }
-                previous = p2.vertices[0];
-                for (size_t vertexindex = 1; vertexindex < p2.size; vertexindex += 1) {
-                    nextinside = p2.vertices[vertexindex].y <= 1.F;
-                    if ((inside && !nextinside) || (!inside && nextinside)) {
-                        /* Append intersection point to p1 */
-                        float ratio = (1.F - previous.y) / (p2.vertices[vertexindex].y - previous.y);
-                        p1.vertices[p1.size].x = previous.x + (p2.vertices[vertexindex].x - previous.x) * ratio;
-                        p1.vertices[p1.size].y = 1.F;
-                        p1.vertices[p1.size].z = previous.z + (p2.vertices[vertexindex].z - previous.z) * ratio;
-                        p1.size += 1;
-                    }
-                    if (nextinside) {
-                        p1.vertices[p1.size] = p2.vertices[vertexindex];
-                        p1.size += 1;
-                    }
-                    inside = nextinside;
-                    previous = p2.vertices[vertexindex];
-                }
-                nextinside = p2.vertices[0].y <= 1.F;
-                if ((inside && !nextinside) || (!inside && nextinside)) {
-                    /* Append intersection point to p1 */
-                    float ratio = (1.F - previous.y) / (p2.vertices[0].y - previous.y);
-                    p1.vertices[p1.size].x = previous.x + (p2.vertices[0].x - previous.x) * ratio;
-                    p1.vertices[p1.size].y = 1.F;
-                    p1.vertices[p1.size].z = previous.z + (p2.vertices[0].z - previous.z) * ratio;
-                    p1.size += 1;
-                }
-                if (p1.size < 3) {
-                    continue;
-                }
+    /* Frustum culling of whole subtrees of the bounding volume hierarchy in model space */
+    double stagestart = getmilliseconds();
+    tracezone stagezone;
+    begintracezone(&stagezone, "cull");
+    stats->trianglesin = mesh->trianglecount;
+    const uint32_t * indices = mesh->indices;
+    uint32_t * visibleindices = NULL;
+    size_t trianglecount = mesh->trianglecount;
+    bool frustumculled = false;
+    if (mesh->nodes != NULL) {
+        float clipmatrix[16];
+        memcpy(clipmatrix, transformationmatrix, sizeof clipmatrix);
+        calculatenewtransformationmatrix(clipmatrix, projectionmatrix);
+        uint64_t * visiblemask = allocatescratch(scratch, (trianglecount + 63) / 64 * sizeof(uint64_t));
+        if (visiblemask == NULL) {
+            releaseindexedmesh(temporarymesh);
+            context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+            return;
+        }
+        if (cullmeshfrustum(mesh, clipmatrix, visiblemask)) {
+            visibleindices = allocatescratch(scratch, trianglecount * 3 * sizeof(uint32_t));
+            if (visibleindices == NULL) {
+                releaseindexedmesh(temporarymesh);
+                context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+                return;
+            }
 
-                /* Check p1 against z >= 0 and save clipped polygon in p2 */
-                p2.size = 0;
-                inside = p1.vertices[0].z >= 0.F;
-                if (inside) {
-                    p2.vertices[p2.size] = p1.vertices[0];
-                    p2.size += 1;
-                }
-                previous = p1.vertices[0];
-                for (size_t vertexindex = 1; vertexindex < p1.size; vertexindex += 1) {
-                    nextinside = p1.vertices[vertexindex].z >= 0.F;
-                    if ((inside && !nextinside) || (!inside && nextinside)) {
-                        /* Append intersection point to p2 */
-                        float ratio = -previous.z / (p1.vertices[vertexindex].z - previous.z);
-                        p2.vertices[p2.size].x = previous.x + (p1.vertices[vertexindex].x - previous.x) * ratio;
-                        p2.vertices[p2.size].y = previous.y + (p1.vertices[vertexindex].y - previous.y) * ratio;
-                        p2.vertices[p2.size].z = 0.F;
-                        p2.size += 1;
-                    }
-                    if (nextinside) {
-                        p2.vertices[p2.size] = p1.vertices[vertexindex];
-                        p2.size += 1;
-                    }
-                    inside = nextinside;
-                    previous = p1.vertices[vertexindex];
-                }
-                nextinside = p1.vertices[0].z >= 0.F;
-                if ((inside && !nextinside) || (!inside && nextinside)) {
-                    /* Append intersection point to p2 */
-                    float ratio = -previous.z / (p1.vertices[0].z - previous.z);
-                    p2.vertices[p2.size].x = previous.x + (p1.vertices[0].x - previous.x) * ratio;
-                    p2.vertices[p2.size].y = previous.y + (p1.vertices[0].y - previous.y) * ratio;
-                    p2.vertices[p2.size].z = 0.F;
-                    p2.size += 1;
-                }
-                if (p2.size < 3) {
-                    continue;
+            /* Visible triangles keep their original order */
+            size_t visiblecount = 0;
+            for (size_t triangleindex = 0; triangleindex < trianglecount; triangleindex += 1) {
+                if (visiblemask[triangleindex / 64] >> (triangleindex % 64) & 1U) {
+                    memcpy(&visibleindices[visiblecount * 3], &mesh->indices[triangleindex * 3], 3 * sizeof(uint32_t));
+                    visiblecount += 1;
                 }
+            }
+            trianglecount = visiblecount;
+            indices = visibleindices;
+            frustumculled = true;
+        }
+    }
 
-                /* Check p2 against z <= 1 and save clipped polygon in p1 */
-                p1.size = 0;
-                inside = p2.vertices[0].z <= 1.F;
-                if (inside) {
-                    p1.vertices[p1.size] = p2.vertices[0];
-                    p1.size += 1;
-                }
-                previous = p2.vertices[0];
-                for (size_t vertexindex = 1; vertexindex < p2.size; vertexindex += 1) {
-                    nextinside = p2.vertices[vertexindex].z <= 1.F;
-                    if ((inside && !nextinside) || (!inside && nextinside)) {
-                        /* Append intersection point to p1 */
-                        float ratio = (1.F - previous.z) / (p2.vertices[vertexindex].z - previous.z);
-                        p1.vertices[p1.size].x = previous.x + (p2.vertices[vertexindex].x - previous.x) * ratio;
-                        p1.vertices[p1.size].y = previous.y + (p2.vertices[vertexindex].y - previous.y) * ratio;
-                        p1.vertices[p1.size].z = 1.F;
-                        p1.size += 1;
-                    }
-                    if (nextinside) {
-                        p1.vertices[p1.size] = p2.vertices[vertexindex];
-                        p1.size += 1;
-                    }
-                    inside = nextinside;
-                    previous = p2.vertices[vertexindex];
-                }
-                nextinside = p2.vertices[0].z <= 1.F;
-                if ((inside && !nextinside) || (!inside && nextinside)) {
-                    /* Append intersection point to p1 */
-                    float ratio = (1.F - previous.z) / (p2.vertices[0].z - previous.z);
-                    p1.vertices[p1.size].x = previous.x + (p2.vertices[0].x - previous.x) * ratio;
-                    p1.vertices[p1.size].y = previous.y + (p2.vertices[0].y - previous.y) * ratio;
-                    p1.vertices[p1.size].z = 1.F;
-                    p1.size += 1;
-                }
-                if (p1.size < 3) {
-                    continue;
-                }
+    /* Culling and triangle assembly run over chunks of triangles, at most one per render thread */
+    size_t chunkcount = context->renderthreads == 0U ? getprocessorcount() : context->renderthreads;
 
-                /* Add new triangles */
-                if (newsize + p1.size - 2 > transformedtriangles.size) {
-                    reallocpointer = realloc(newdata, (newsize + p1.size - 2) * sizeof(triangle));
-                    if (reallocpointer == NULL) {
-                        free(newlightingtable);
-                        free(lightingtable);
-                        free(newdata);
-                        releasetriangles(&transformedtriangles);
-                        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-                        return;
-                    }
-                    newdata = reallocpointer;
-                    reallocpointer = realloc(newlightingtable, (newsize + p1.size - 2) * sizeof(light));
-                    if (reallocpointer == NULL) {
-                        free(newlightingtable);
-                        free(lightingtable);
-                        free(newdata);
-                        releasetriangles(&transformedtriangles);
-                        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-                        return;
-                    }
-                    newlightingtable = reallocpointer;
-                }
-                for (size_t newtriangleindex = 0; newtriangleindex < p1.size - 2; newtriangleindex += 1) {
-                    newdata[newsize].v1 = p1.vertices[0];
-                    newdata[newsize].w1 = 1.F;
-                    newdata[newsize].v2 = p1.vertices[newtriangleindex + 1];
-                    newdata[newsize].w2 = 1.F;
-                    newdata[newsize].v3 = p1.vertices[newtriangleindex + 2];
-                    newdata[newsize].w3 = 1.F;
-                    newlightingtable[newsize].red = lightingtable[triangleindex].red;
-                    newlightingtable[newsize].green = lightingtable[triangleindex].green;
-                    newlightingtable[newsize].blue = lightingtable[triangleindex].blue;
-                    newsize += 1;
-                }
-            }
+    /* Model-space backface culling */
+    point modelspacecameraposition;
+    point intermediatepoint;
+    if (context->backfaceculling) {
+        intermediatepoint.x = context->cameraposition.x - context->objectposition.x;
+        intermediatepoint.y = context->cameraposition.y - context->objectposition.y;
+        intermediatepoint.z = context->cameraposition.z - context->objectposition.z;
+        modelspacecameraposition.x = costhetaz * intermediatepoint.x + sinthetaz * intermediatepoint.y;
+        modelspacecameraposition.y = -sinthetaz * intermediatepoint.x + costhetaz * intermediatepoint.y;
+        modelspacecameraposition.z = intermediatepoint.z;
+        intermediatepoint.x = costhetay * modelspacecameraposition.x + -sinthetay * modelspacecameraposition.z;
+        intermediatepoint.y = modelspacecameraposition.y;
+        intermediatepoint.z = sinthetay * modelspacecameraposition.x + costhetay * modelspacecameraposition.z;
+        modelspacecameraposition.x = intermediatepoint.x / context->objectscalingx;
+        modelspacecameraposition.y = (costhetax * intermediatepoint.y + sinthetax * intermediatepoint.z) / context->objectscalingy;
+        modelspacecameraposition.z = (-sinthetax * intermediatepoint.y + costhetax * intermediatepoint.z) / context->objectscalingz;
+        uint8_t * frontfacing = allocatescratch(scratch, trianglecount);
+        uint32_t * frontindices = allocatescratch(scratch, trianglecount * 3 * sizeof(uint32_t));
+        cullchunk * cullchunks = allocatescratch(scratch, chunkcount * sizeof(cullchunk));
+        if (frontfacing == NULL || frontindices == NULL || cullchunks == NULL) {
+            releaseindexedmesh(temporarymesh);
+            context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+            return;
         }
+        trianglecount = cullmeshtriangles(mesh, indices, trianglecount, &modelspacecameraposition, frontfacing, frontindices, cullchunks, chunkcount);
+        indices = frontindices;
     }
-    if (newsize == 0) {
-        free(newlightingtable);
-        free(lightingtable);
-        free(newdata);
-        releasetriangles(&transformedtriangles);
+    stats->culltime = getmilliseconds() - stagestart;
+    stats->trianglesculled = mesh->trianglecount - trianglecount;
+    endtracezone(&stagezone);
+    if (trianglecount == 0) {
+        releaseindexedmesh(temporarymesh);
+        stats->peakscratchmemory = scratch->peak;
+        endtracezone(&framezone);
+        context->errornumber = RENDERER_ERROR_NONE;
         return;
     }
-    if (newsize < transformedtriangles.size) {
-        reallocpointer = realloc(newdata, newsize * sizeof(triangle));
-        if (reallocpointer == NULL) {
-            free(newlightingtable);
-            free(lightingtable);
-            free(newdata);
-            releasetriangles(&transformedtriangles);
-            errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-            return;
-        }
-        newdata = reallocpointer;
+
+    /* Model-view, projection, perspective divide, viewport and clip codes in one pass over the unique vertices */
+    stagestart = getmilliseconds();
+    begintracezone(&stagezone, "transform");
+    transformedvertices vertices;
+    if (!allocatetransformedvertices(&vertices, mesh->vertices.size, scratch)) {
+        releaseindexedmesh(temporarymesh);
+        context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        return;
     }
-    if (newsize != transformedtriangles.size) {
-        reallocpointer = realloc(transformedtriangles.data, newsize * sizeof(triangle));
-        if (reallocpointer == NULL) {
-            free(newlightingtable);
-            free(lightingtable);
-            free(newdata);
-            releasetriangles(&transformedtriangles);
-            errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+    /* The viewport maps to the sample grid, AntiAliasing samples per pixel along each axis */
+    int samplegrid = (int)context->antialiasing;
+    int samplewidth = (int)target->width * samplegrid;
+    int sampleheight = (int)target->height * samplegrid;
+    float halfsamplewidth = (float)samplewidth / 2.F;
+    float halfsampleheight = (float)sampleheight / 2.F;
+    if (frustumculled) {
+        /* Only runs of vertices used by a remaining triangle are transformed */
+        uint8_t * usedvertices = allocatescratch(scratch, mesh->vertices.size);
+        if (usedvertices == NULL) {
+            releaseindexedmesh(temporarymesh);
+            context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
             return;
         }
-        transformedtriangles.data = reallocpointer;
-        transformedtriangles.size = newsize;
-    }
-    temp = transformedtriangles.data;
-    transformedtriangles.data = newdata;
-    newdata = temp;
-    free(lightingtable);
-    lightingtable = realloc(newlightingtable, newsize * sizeof(light));
-    if (lightingtable == NULL) {
-        free(newlightingtable);
-        free(newdata);
-        releasetriangles(&transformedtriangles);
-        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
-        return;
+        memset(usedvertices, 0, mesh->vertices.size);
+        for (size_t corner = 0; corner < trianglecount * 3; corner += 1) {
+            usedvertices[indices[corner]] = 1;
+        }
+        size_t first = 0;
+        while (first < mesh->vertices.size) {
+            if (!usedvertices[first]) {
+                first += 1;
+                continue;
+            }
+            size_t last = first + 1;
+            while (last < mesh->vertices.size && usedvertices[last]) {
+                last += 1;
+            }
+            transformvertices(&mesh->vertices, first, last, transformationmatrix, projectionmatrix, halfsamplewidth, halfsampleheight, &vertices);
+            first = last;
+        }
+    } else {
+        transformvertices(&mesh->vertices, 0, mesh->vertices.size, transformationmatrix, projectionmatrix, halfsamplewidth, halfsampleheight, &vertices);
     }
+    stats->transformtime = getmilliseconds() - stagestart;
+    endtracezone(&stagezone);
 
-    /* Viewport transformation */
-    transformationmatrix[0] = (float)target->width;
-    transformationmatrix[1] = 0.F;
-    transformationmatrix[2] = 0.F;
-    transformationmatrix[3] = 0.F;
-    transformationmatrix[4] = 0.F;
-    transformationmatrix[5] = -(float)target->height;
-    transformationmatrix[6] = 0.F;
-    transformationmatrix[7] = 0.F;
-    transformationmatrix[8] = 0.F;
-    transformationmatrix[9] = 0.F;
-    transformationmatrix[10] = 1.F;
-    transformationmatrix[11] = 0.F;
-    transformationmatrix[12] = (float)target->width;
-    transformationmatrix[13] = (float)target->height;
-    transformationmatrix[14] = 0.F;
-    transformationmatrix[15] = 1.F;
-    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, (int)transformedtriangles.size * 3, 4, 4, 1.F, (float *)transformedtriangles.data, 4, transformationmatrix, 4, 0.F, (float *)newdata, 4);
-    free(transformedtriangles.data);
-    transformedtriangles.data = newdata;
-
-    /* Rasterization */
-    uint32_t * doublesizedsurface = calloc((size_t)target->width * 2 * (size_t)target->height * 2, sizeof(uint32_t));
-    if (doublesizedsurface == NULL) {
-        free(lightingtable);
-        releasetriangles(&transformedtriangles);
-        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+    /* Lighting, trivial accept and reject, and clipping of the remaining triangles */
+    trianglestreams * streams = &context->streams;
+    streams->size = 0;
+    uint8_t * outputcounts = allocatescratch(scratch, trianglecount);
+    assemblychunk * assemblychunks = allocatescratch(scratch, chunkcount * sizeof(assemblychunk));
+    if (outputcounts == NULL || assemblychunks == NULL) {
+        releaseindexedmesh(temporarymesh);
+        context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        return;
+    }
+    bool assembled = assembletriangles(&vertices, indices, trianglecount, &viewspacelightsourceposition, &context->materialdiffusereflectance, halfsamplewidth, halfsampleheight, streams, outputcounts, assemblychunks, chunkcount, stats);
+    releaseindexedmesh(temporarymesh);
+    if (!assembled) {
+        context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        return;
+    }
+    stats->trianglesrasterized = streams->size;
+    if (streams->size == 0) {
+        stats->peakscratchmemory = scratch->peak;
+        endtracezone(&framezone);
+        context->errornumber = RENDERER_ERROR_NONE;
         return;
     }
+
+    /* Rasterization, every tile clears its own region of the buffers, with one sample per pixel it draws into the target directly */
+    uint32_t * samplesurface = target->pixels;
+    if (samplegrid > 1) {
+        samplesurface = allocatescratch(scratch, (size_t)samplewidth * (size_t)sampleheight * sizeof(uint32_t));
+        if (samplesurface == NULL) {
+            context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+            return;
+        }
+    }
+    stagestart = getmilliseconds();
+    begintracezone(&stagezone, "sort");
     float * zbuffer = NULL;
-    if (usezbuffer) {
-        zbuffer = malloc((size_t)target->width * 2 * (size_t)target->height * 2 * sizeof(float));
+    size_t * order = NULL;
+    if (context->usezbuffer) {
+        zbuffer = allocatescratch(scratch, (size_t)samplewidth * (size_t)sampleheight * sizeof(float));
         if (zbuffer == NULL) {
-            free(doublesizedsurface);
-            free(lightingtable);
-            releasetriangles(&transformedtriangles);
-            errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+            context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
             return;
         }
-        for (size_t index = 0; index < (size_t)target->width * 2 * (size_t)target->height * 2; index += 1) {
-            zbuffer[index] = FLT_MAX;
+
+        /* Nearer triangles first let the depth tests reject the ones behind them before any color is written */
+        if (context->fronttobacksort) {
+            order = allocatescratch(scratch, streams->size * sizeof(size_t));
+            uint16_t * keys = allocatescratch(scratch, streams->size * sizeof(uint16_t));
+            size_t * bucketoffsets = allocatescratch(scratch, (DEPTH_SORT_BUCKETS + 1) * sizeof(size_t));
+            if (order == NULL || keys == NULL || bucketoffsets == NULL) {
+                context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+                return;
+            }
+            sortfronttoback(streams, keys, bucketoffsets, order);
         }
     } else {
-        srand((unsigned int)time(NULL));
-        zsortingsubroutine(transformedtriangles.data, lightingtable, 0, transformedtriangles.size - 1);
-    }
-    for (size_t triangleindex = 0; triangleindex < transformedtriangles.size; triangleindex += 1) {
-        int minx = (int)roundf(fminf(transformedtriangles.data[triangleindex].v1.x, fminf(transformedtriangles.data[triangleindex].v2.x, transformedtriangles.data[triangleindex].v3.x)));
-        int maxx = (int)roundf(fmaxf(transformedtriangles.data[triangleindex].v1.x, fmaxf(transformedtriangles.data[triangleindex].v2.x, transformedtriangles.data[triangleindex].v3.x)));
-        int miny = (int)roundf(fminf(transformedtriangles.data[triangleindex].v1.y, fminf(transformedtriangles.data[triangleindex].v2.y, transformedtriangles.data[triangleindex].v3.y)));
-        int maxy = (int)roundf(fmaxf(transformedtriangles.data[triangleindex].v1.y, fmaxf(transformedtriangles.data[triangleindex].v2.y, transformedtriangles.data[triangleindex].v3.y)));
-        int x1 = (int)(roundf(transformedtriangles.data[triangleindex].v2.x) - roundf(transformedtriangles.data[triangleindex].v1.x));
-        int y1 = (int)(roundf(transformedtriangles.data[triangleindex].v2.y) - roundf(transformedtriangles.data[triangleindex].v1.y));
-        int x2 = (int)(roundf(transformedtriangles.data[triangleindex].v3.x) - roundf(transformedtriangles.data[triangleindex].v1.x));
-        int y2 = (int)(roundf(transformedtriangles.data[triangleindex].v3.y) - roundf(transformedtriangles.data[triangleindex].v1.y));
-
-        if (usezbuffer) {
-            vector v1 = {
-                transformedtriangles.data[triangleindex].v2.x - transformedtriangles.data[triangleindex].v1.x,
-                transformedtriangles.data[triangleindex].v2.y - transformedtriangles.data[triangleindex].v1.y,
-                transformedtriangles.data[triangleindex].v2.z - transformedtriangles.data[triangleindex].v1.z
-            };
-            vector v2 = {
-                transformedtriangles.data[triangleindex].v3.x - transformedtriangles.data[triangleindex].v1.x,
-                transformedtriangles.data[triangleindex].v3.y - transformedtriangles.data[triangleindex].v1.y,
-                transformedtriangles.data[triangleindex].v3.z - transformedtriangles.data[triangleindex].v1.z
-            };
-            vector normal;
-            crossproduct(&normal, &v1, &v2);
-            float d = dotproduct(&normal, (const vector *)&transformedtriangles.data[triangleindex].v1);
-
-            for (int x = minx; x <= maxx; x += 1) {
-                for (int y = miny; y <= maxy; y += 1) {
-                    int x3 = x - (int)roundf(transformedtriangles.data[triangleindex].v1.x);
-                    int y3 = y - (int)roundf(transformedtriangles.data[triangleindex].v1.y);
-                    int r = x1 * y2 - y1 * x2;
-                    int s = x3 * y2 - y3 * x2;
-                    int t = x1 * y3 - y1 * x3;
-                    if ((r > 0 && s >= 0 && t >= 0 && s + t <= r) || (r < 0 && s <= 0 && t <= 0 && s + t >= r)) {
-                        if (x != (int)target->width * 2 && y != (int)target->height * 2) {
-                            assert(x >= 0 && x < (int)target->width * 2 && y >= 0 && y < (int)target->height * 2);
-                            float z = -(normal.x * x + normal.y * y - d) / normal.z;
-                            if (z < zbuffer[y * target->width * 2 + x]) {
-                                doublesizedsurface[y * target->width * 2 + x] = 0xFF000000 | (uint32_t)roundf(lightingtable[triangleindex].blue * 255.F) << 16 | (uint32_t)roundf(lightingtable[triangleindex].green * 255.F) << 8 | (uint32_t)roundf(lightingtable[triangleindex].red * 255.F);
-                                zbuffer[y * target->width * 2 + x] = z;
-                            }
-                        }
-                    }
-                }
-            }
-        } else {
-            for (int x = minx; x <= maxx; x += 1) {
-                for (int y = miny; y <= maxy; y += 1) {
-                    int x3 = x - (int)roundf(transformedtriangles.data[triangleindex].v1.x);
-                    int y3 = y - (int)roundf(transformedtriangles.data[triangleindex].v1.y);
-                    int r = x1 * y2 - y1 * x2;
-                    int s = x3 * y2 - y3 * x2;
-                    int t = x1 * y3 - y1 * x3;
-                    if ((r > 0 && s >= 0 && t >= 0 && s + t <= r) || (r < 0 && s <= 0 && t <= 0 && s + t >= r)) {
-                        if (x != (int)target->width * 2 && y != (int)target->height * 2) {
-                            assert(x >= 0 && x < (int)target->width * 2 && y >= 0 && y < (int)target->height * 2);
-                            doublesizedsurface[y * target->width * 2 + x] = 0xFF000000 | (uint32_t)roundf(lightingtable[triangleindex].blue * 255.F) << 16 | (uint32_t)roundf(lightingtable[triangleindex].green * 255.F) << 8 | (uint32_t)roundf(lightingtable[triangleindex].red * 255.F);
-                        }
-                    }
+        /* Sort triangle indices far to near by centroid depth, the streams themselves stay in place */
+        size_t sortchunkcount = chunkcount;
+        if (sortchunkcount > streams->size / RADIX_SORT_MINIMUM_CHUNK + 1) {
+            sortchunkcount = streams->size / RADIX_SORT_MINIMUM_CHUNK + 1;
+        }
+        uint32_t * keys = allocatescratch(scratch, streams->size * sizeof(uint32_t));
+        uint32_t * sortedkeys = allocatescratch(scratch, streams->size * sizeof(uint32_t));
+        size_t * sortindices = allocatescratch(scratch, streams->size * sizeof(size_t));
+        size_t * sortedindices = allocatescratch(scratch, streams->size * sizeof(size_t));
+        radixsortchunk * chunks = allocatescratch(scratch, sortchunkcount * sizeof(radixsortchunk));
+        if (keys == NULL || sortedkeys == NULL || sortindices == NULL || sortedindices == NULL || chunks == NULL) {
+            context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+            return;
+        }
+        for (size_t triangleindex = 0; triangleindex < streams->size; triangleindex += 1) {
+            sortindices[triangleindex] = triangleindex;
+            keys[triangleindex] = ~floattosortablekey((streams->z[triangleindex * 3] + streams->z[triangleindex * 3 + 1] + streams->z[triangleindex * 3 + 2]) / 3.F);
+        }
+        order = radixsort(keys, sortindices, sortedkeys, sortedindices, streams->size, chunks, sortchunkcount);
+    }
+    stats->sorttime = getmilliseconds() - stagestart;
+    endtracezone(&stagezone);
+    stagestart = getmilliseconds();
+    begintracezone(&stagezone, "bin");
+    /* Bin triangles into screen tiles, a tile covers whole pixels so it resolves on its own */
+    int tilesize = RASTER_TILE_SIZE / samplegrid * samplegrid;
+    size_t tilecolumns = ((size_t)samplewidth + (size_t)tilesize - 1) / (size_t)tilesize;
+    size_t tilerows = ((size_t)sampleheight + (size_t)tilesize - 1) / (size_t)tilesize;
+    size_t tilecount = tilecolumns * tilerows;
+    size_t * binoffsets = allocatescratch(scratch, (tilecount + 1) * sizeof(size_t));
+    size_t * bincursors = allocatescratch(scratch, tilecount * sizeof(size_t));
+    if (binoffsets == NULL || bincursors == NULL) {
+        context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        return;
+    }
+    memset(binoffsets, 0, (tilecount + 1) * sizeof(size_t));
+    int minx;
+    int maxx;
+    int miny;
+    int maxy;
+    for (size_t triangleindex = 0; triangleindex < streams->size; triangleindex += 1) {
+        if (gettrianglebounds(streams, triangleindex, samplewidth, sampleheight, &minx, &maxx, &miny, &maxy)) {
+            for (size_t tiley = (size_t)miny / (size_t)tilesize; tiley <= (size_t)maxy / (size_t)tilesize; tiley += 1) {
+                for (size_t tilex = (size_t)minx / (size_t)tilesize; tilex <= (size_t)maxx / (size_t)tilesize; tilex += 1) {
+                    binoffsets[tiley * tilecolumns + tilex + 1] += 1;
                 }
             }
         }
     }
-    for (size_t y = 0; y < (size_t)target->height; y += 1) {
-        for (size_t x = 0; x < (size_t)target->width; x += 1) {
-            uint8_t alpha = ((doublesizedsurface[y * 2 * (size_t)target->width * 2 + x * 2] >> 24) + (doublesizedsurface[y * 2 * (size_t)target->width * 2 + x * 2 + 1] >> 24) + (doublesizedsurface[(y * 2 + 1) * (size_t)target->width * 2 + x * 2] >> 24) + (doublesizedsurface[(y * 2 + 1) * (size_t)target->width * 2 + x * 2 + 1] >> 24)) / 4;
-            uint16_t tempred = 0U;
-            uint16_t tempgreen = 0U;
-            uint16_t tempblue = 0U;
-            size_t opaquepixels = 0;
-            if (doublesizedsurface[y * 2 * (size_t)target->width * 2 + x * 2] >> 24 == 0xFFU) {
-                tempred += doublesizedsurface[y * 2 * (size_t)target->width * 2 + x * 2] & 0xFFU;
-                tempgreen += doublesizedsurface[y * 2 * (size_t)target->width * 2 + x * 2] >> 8 & 0xFFU;
-                tempblue += doublesizedsurface[y * 2 * (size_t)target->width * 2 + x * 2] >> 16 & 0xFFU;
-                opaquepixels += 1;
-            }
-            if (doublesizedsurface[y * 2 * (size_t)target->width * 2 + x * 2 + 1] >> 24 == 0xFFU) {
-                tempred += doublesizedsurface[y * 2 * (size_t)target->width * 2 + x * 2 + 1] & 0xFFU;
-                tempgreen += doublesizedsurface[y * 2 * (size_t)target->width * 2 + x * 2 + 1] >> 8 & 0xFFU;
-                tempblue += doublesizedsurface[y * 2 * (size_t)target->width * 2 + x * 2 + 1] >> 16 & 0xFFU;
-                opaquepixels += 1;
-            }
-            if (doublesizedsurface[(y * 2 + 1) * (size_t)target->width * 2 + x * 2] >> 24 == 0xFFU) {
-                tempred += doublesizedsurface[(y * 2 + 1) * (size_t)target->width * 2 + x * 2] & 0xFFU;
-                tempgreen += doublesizedsurface[(y * 2 + 1) * (size_t)target->width * 2 + x * 2] >> 8 & 0xFFU;
-                tempblue += doublesizedsurface[(y * 2 + 1) * (size_t)target->width * 2 + x * 2] >> 16 & 0xFFU;
-                opaquepixels += 1;
-            }
-            if (doublesizedsurface[(y * 2 + 1) * (size_t)target->width * 2 + x * 2 + 1] >> 24 == 0xFFU) {
-                tempred += doublesizedsurface[(y * 2 + 1) * (size_t)target->width * 2 + x * 2 + 1] & 0xFFU;
-                tempgreen += doublesizedsurface[(y * 2 + 1) * (size_t)target->width * 2 + x * 2 + 1] >> 8 & 0xFFU;
-                tempblue += doublesizedsurface[(y * 2 + 1) * (size_t)target->width * 2 + x * 2 + 1] >> 16 & 0xFFU;
-                opaquepixels += 1;
-            }
-            if (opaquepixels != 0) {
-                uint8_t red = (uint8_t)(tempred / opaquepixels);
-                uint8_t green = (uint8_t)(tempgreen / opaquepixels);
-                uint8_t blue = (uint8_t)(tempblue / opaquepixels);
-                target->pixels[y * target->width + x] = (uint32_t)alpha << 24 | (uint32_t)blue << 16 | (uint32_t)green << 8 | (uint32_t)red;
+    for (size_t tileindex = 0; tileindex < tilecount; tileindex += 1) {
+        binoffsets[tileindex + 1] += binoffsets[tileindex];
+        bincursors[tileindex] = binoffsets[tileindex];
+    }
+    size_t * binentries = allocatescratch(scratch, binoffsets[tilecount] * sizeof(size_t));
+    if (binentries == NULL) {
+        context->errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        return;
+    }
+    for (size_t sortedindex = 0; sortedindex < streams->size; sortedindex += 1) {
+        size_t triangleindex = order != NULL ? order[sortedindex] : sortedindex;
+        if (gettrianglebounds(streams, triangleindex, samplewidth, sampleheight, &minx, &maxx, &miny, &maxy)) {
+            for (size_t tiley = (size_t)miny / (size_t)tilesize; tiley <= (size_t)maxy / (size_t)tilesize; tiley += 1) {
+                for (size_t tilex = (size_t)minx / (size_t)tilesize; tilex <= (size_t)maxx / (size_t)tilesize; tilex += 1) {
+                    binentries[bincursors[tiley * tilecolumns + tilex]] = triangleindex;
+                    bincursors[tiley * tilecolumns + tilex] += 1;
+                }
             }
         }
     }
-    if (usezbuffer) {
-        free(zbuffer);
+
+    endtracezone(&stagezone);
+
+    /* Rasterize and resolve tiles in parallel, every tile owns its region of the buffers */
+    if (!context->spankernelselected) {
+        context->spankernel = selectspankernel();
+        context->spankernelselected = true;
+    }
+    rasterjob job;
+    job.spankernel = context->spankernel;
+    job.streams = streams;
+    job.binoffsets = binoffsets;
+    job.binentries = binentries;
+    job.samplesurface = samplesurface;
+    job.zbuffer = zbuffer;
+    job.target = target;
+    job.samplegrid = samplegrid;
+    job.samplewidth = samplewidth;
+    job.sampleheight = sampleheight;
+    job.tilesize = tilesize;
+    job.tilecolumns = tilecolumns;
+    job.tilerows = tilerows;
+    job.nexttile = 0;
+    job.rastertime = 0.0;
+    job.resolvetime = 0.0;
+    job.samplestested = 0;
+    job.sampleswritten = 0;
+    initializemutex(&job.mutex);
+    size_t threadcount = context->renderthreads == 0U ? getprocessorcount() : context->renderthreads;
+    if (threadcount > tilecount) {
+        threadcount = tilecount;
     }
-    free(doublesizedsurface);
+    runinparallel(rasterizationworker, &job, 0, threadcount);
+    destroymutex(&job.mutex);
 
-    free(lightingtable);
-    releasetriangles(&transformedtriangles);
-    errornumber = RENDERER_ERROR_NONE;
+    /* Tiles are rasterized and resolved by the same workers, the wall time is split by the share each had of their busy time */
+    double elapsed = getmilliseconds() - stagestart;
+    if (job.rastertime + job.resolvetime > 0.0) {
+        stats->resolvetime = elapsed * job.resolvetime / (job.rastertime + job.resolvetime);
+    }
+    stats->rastertime = elapsed - stats->resolvetime;
+    stats->samplestested = job.samplestested;
+    stats->sampleswritten = job.sampleswritten;
+    stats->peakscratchmemory = scratch->peak;
+    endtracezone(&framezone);
+    context->errornumber = RENDERER_ERROR_NONE;
 }
 
 void savesurfacetopngfile(const surface * s, const char * filename)
 {
-    png_FILE_p filepointer = fopen(filename, "wb");
-    if (filepointer == NULL) {
-        errornumber = RENDERER_ERROR_FILEOPENFAILED;
-        return;
-    }
+    savesurfacetopngfile_ctx(&defaultcontext, s, filename);
+}
 
-    png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-    if (png == NULL) {
-        fclose(filepointer);
-        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+void savesurfacetopngfile_ctx(renderer_context * context, const surface * s, const char * filename)
+{
+    double start = getmilliseconds();
+    tracezone zone;
+    begintracezone(&zone, "savesurfacetopngfile");
+    if (s->width == 0U || s->height == 0U) {
+        context->errornumber = RENDERER_ERROR_INVALIDVALUE;
         return;
     }
 
-    png_infop info = png_create_info_struct(png);
-    if (info == NULL) {
-        png_destroy_write_struct(&png, &info);
-        fclose(filepointer);
-        errornumber = RENDERER_ERROR_INSUFFICIENTMEMORY;
+    FILE * filepointer = fopen(filename, "wb");
+    if (filepointer == NULL) {
+        context->errornumber = RENDERER_ERROR_FILEOPENFAILED;
         return;
     }
 
-    png_set_IHDR(png, info, s->width, s->height, 8, PNG_COLOR_TYPE_RGB_ALPHA, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-    png_bytepp rows = png_malloc(png, (png_alloc_size_t)s->height * sizeof(png_bytep));
-    for (uint16_t y = 0U; y < s->height; y += 1U) {
-        png_uint_32p row = png_malloc(png, (png_alloc_size_t)s->width * sizeof(png_uint_32));
-        rows[y] = (png_bytep)row;
-        for (uint16_t x = 0U; x < s->width; x += 1U) {
-            *row = (png_uint_32)s->pixels[y * s->width + x];
-            row += 1;
+    /* With PngParallelDeflate, tall images are split into row bands compressed in parallel, anything else goes through libpng */
+    size_t bandcount = 1;
+    if (context->pngparalleldeflate) {
+        size_t rowsize = (size_t)s->width * 4 + 1;
+        bandcount = context->renderthreads == 0U ? getprocessorcount() : context->renderthreads;
+        if (bandcount > (size_t)s->height / PNG_BAND_MINIMUM_ROWS) {
+            bandcount = (size_t)s->height / PNG_BAND_MINIMUM_ROWS;
         }
+        if (bandcount < ((size_t)s->height * rowsize + PNG_BAND_MAXIMUM_SIZE - 1) / PNG_BAND_MAXIMUM_SIZE) {
+            bandcount = ((size_t)s->height * rowsize + PNG_BAND_MAXIMUM_SIZE - 1) / PNG_BAND_MAXIMUM_SIZE;
+        }
+    }
+    int error = RENDERER_ERROR_NONE;
+    if (bandcount > 1) {
+        error = writepnginparallel(context, s, filepointer, bandcount);
+    } else if (!writepngserially(context, s, filepointer)) {
+        error = RENDERER_ERROR_INSUFFICIENTMEMORY;
     }
 
-    png_init_io(png, filepointer);
-    png_set_rows(png, info, rows);
-    png_write_png(png, info, PNG_TRANSFORM_IDENTITY, NULL);
-    for (uint16_t y = 0U; y < s->height; y += 1U) {
-        png_free(png, rows[y]);
+    if (fclose(filepointer) == EOF && error == RENDERER_ERROR_NONE) {
+        error = RENDERER_ERROR_FILECLOSEFAILED;
     }
-    png_free(png, rows);
-    png_destroy_write_struct(&png, &info);
+    context->stats.encodetime = getmilliseconds() - start;
+    endtracezone(&zone);
+    context->errornumber = error;
+}
 
-    if (fclose(filepointer) == EOF) {
-        errornumber = RENDERER_ERROR_FILECLOSEFAILED;
+void savesurfacetofile(const surface * s, const char * filename)
+{
+    savesurfacetofile_ctx(&defaultcontext, s, filename);
+}
+
+void savesurfacetofile_ctx(renderer_context * context, const surface * s, const char * filename)
+{
+    int format = getoutputformat(context, filename);
+    if (format == RENDERER_OUTPUT_FORMAT_PNG) {
+        savesurfacetopngfile_ctx(context, s, filename);
+        return;
+    }
+    double start = getmilliseconds();
+    tracezone zone;
+    begintracezone(&zone, "savesurfacetofile");
+    if (s->width == 0U || s->height == 0U) {
+        context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        return;
+    }
+
+    FILE * filepointer = fopen(filename, "wb");
+    if (filepointer == NULL) {
+        context->errornumber = RENDERER_ERROR_FILEOPENFAILED;
         return;
     }
 
-    errornumber = RENDERER_ERROR_NONE;
+    bool written;
+    if (format == RENDERER_OUTPUT_FORMAT_PPM) {
+        written = writeppm(s, filepointer);
+    } else if (format == RENDERER_OUTPUT_FORMAT_PAM) {
+        written = writepam(s, filepointer);
+    } else if (format == RENDERER_OUTPUT_FORMAT_QOI) {
+        written = writeqoi(s, filepointer);
+    } else {
+        written = writerawrgba(s, filepointer);
+    }
+
+    int error = written ? RENDERER_ERROR_NONE : RENDERER_ERROR_FILEWRITEFAILED;
+    if (fclose(filepointer) == EOF && error == RENDERER_ERROR_NONE) {
+        error = RENDERER_ERROR_FILECLOSEFAILED;
+    }
+    context->stats.encodetime = getmilliseconds() - start;
+    endtracezone(&zone);
+    context->errornumber = error;
 }
 
-static int inicallback(IniDispatch * dispatch, void * user_data)
+void getrenderstats(renderer_stats * stats)
 {
-    if (dispatch->type == INI_SECTION) {
-        const char * source = dispatch->data;
-        for (size_t i = 0; i < 64; i += 1) {
-            inisection[i] = *source;
-            if (*source == '\0') {
-                break;
-            } else if (i == 63) {
-                inisection[i] = '\0';
-            } else {
-                source += 1;
-            }
-        }
-    } else if (dispatch->type == INI_KEY) {
-        if (strcmp(inisection, "Renderer") == 0) {
-            if (strcmp(dispatch->data, "LightSourcePositionX") == 0) {
-                if (sscanf(dispatch->value, "%f", &lightsourceposition.x) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "LightSourcePositionY") == 0) {
-                if (sscanf(dispatch->value, "%f", &lightsourceposition.y) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "LightSourcePositionZ") == 0) {
-                if (sscanf(dispatch->value, "%f", &lightsourceposition.z) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "CameraPositionX") == 0) {
-                if (sscanf(dispatch->value, "%f", &cameraposition.x) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "CameraPositionY") == 0) {
-                if (sscanf(dispatch->value, "%f", &cameraposition.y) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "CameraPositionZ") == 0) {
-                if (sscanf(dispatch->value, "%f", &cameraposition.z) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "CameraLookAtPointX") == 0) {
-                if (sscanf(dispatch->value, "%f", &cameralookatpoint.x) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "CameraLookAtPointY") == 0) {
-                if (sscanf(dispatch->value, "%f", &cameralookatpoint.y) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "CameraLookAtPointZ") == 0) {
-                if (sscanf(dispatch->value, "%f", &cameralookatpoint.z) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "UpVectorX") == 0) {
-                if (sscanf(dispatch->value, "%f", &up.x) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "UpVectorY") == 0) {
-                if (sscanf(dispatch->value, "%f", &up.y) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "UpVectorZ") == 0) {
-                if (sscanf(dispatch->value, "%f", &up.z) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "ObjectPositionX") == 0) {
-                if (sscanf(dispatch->value, "%f", &objectposition.x) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "ObjectPositionY") == 0) {
-                if (sscanf(dispatch->value, "%f", &objectposition.y) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "ObjectPositionZ") == 0) {
-                if (sscanf(dispatch->value, "%f", &objectposition.z) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "ObjectRotationX") == 0) {
-                if (sscanf(dispatch->value, "%f", &objectrotationxdegree) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                } else {
-                    objectrotationx = degreetoradian(objectrotationxdegree);
-                }
-            } else if (strcmp(dispatch->data, "ObjectRotationY") == 0) {
-                if (sscanf(dispatch->value, "%f", &objectrotationydegree) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                } else {
-                    objectrotationy = degreetoradian(objectrotationydegree);
-                }
-            } else if (strcmp(dispatch->data, "ObjectRotationZ") == 0) {
-                if (sscanf(dispatch->value, "%f", &objectrotationzdegree) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                } else {
-                    objectrotationz = degreetoradian(objectrotationzdegree);
-                }
-            } else if (strcmp(dispatch->data, "ObjectScalingX") == 0) {
-                if (sscanf(dispatch->value, "%f", &objectscalingx) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "ObjectScalingY") == 0) {
-                if (sscanf(dispatch->value, "%f", &objectscalingy) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "ObjectScalingZ") == 0) {
-                if (sscanf(dispatch->value, "%f", &objectscalingz) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "FieldOfView") == 0) {
-                if (sscanf(dispatch->value, "%f", &fieldofviewdegree) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                } else if (fieldofviewdegree < 0.F || fieldofviewdegree > 180.F) {
-                    errornumber = RENDERER_ERROR_INVALIDVALUE;
-                } else {
-                    fieldofview = degreetoradian(fieldofviewdegree);
-                }
-            } else if (strcmp(dispatch->data, "zNear") == 0) {
-                if (sscanf(dispatch->value, "%f", &znear) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                } else if (znear < FLT_EPSILON) {
-                    errornumber = RENDERER_ERROR_INVALIDVALUE;
-                }
-            } else if (strcmp(dispatch->data, "zFar") == 0) {
-                if (sscanf(dispatch->value, "%f", &zfar) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                } else if (zfar < FLT_EPSILON) {
-                    errornumber = RENDERER_ERROR_INVALIDVALUE;
-                }
-            } else if (strcmp(dispatch->data, "OutputWidth") == 0) {
-                if (sscanf(dispatch->value, "%u", &outputwidth) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                } else if (outputwidth == 0U || outputwidth > 32767U) {
-                    errornumber = RENDERER_ERROR_INVALIDVALUE;
-                }
-            } else if (strcmp(dispatch->data, "OutputHeight") == 0) {
-                if (sscanf(dispatch->value, "%u", &outputheight) != 1) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                } else if (outputheight == 0U || outputheight > 32767U) {
-                    errornumber = RENDERER_ERROR_INVALIDVALUE;
-                }
-            } else if (strcmp(dispatch->data, "MaterialDiffuseReflectance") == 0) {
-                if (strlen(dispatch->value) != 7 || dispatch->value[0] != '#' || !ishexadecimalcharacter(dispatch->value[1]) || !ishexadecimalcharacter(dispatch->value[2]) || !ishexadecimalcharacter(dispatch->value[3]) || !ishexadecimalcharacter(dispatch->value[4]) || !ishexadecimalcharacter(dispatch->value[5]) || !ishexadecimalcharacter(dispatch->value[6])) {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                } else {
-                    materialdiffusereflectancered = hexadecimalcharactertovalue(dispatch->value[1]) * 16 + hexadecimalcharactertovalue(dispatch->value[2]);
-                    materialdiffusereflectancegreen = hexadecimalcharactertovalue(dispatch->value[3]) * 16 + hexadecimalcharactertovalue(dispatch->value[4]);
-                    materialdiffusereflectanceblue = hexadecimalcharactertovalue(dispatch->value[5]) * 16 + hexadecimalcharactertovalue(dispatch->value[6]);
-                    materialdiffusereflectance.red = materialdiffusereflectancered / 255.0F;
-                    materialdiffusereflectance.green = materialdiffusereflectancegreen / 255.0F;
-                    materialdiffusereflectance.blue = materialdiffusereflectanceblue / 255.0F;
-                }
-            } else if (strcmp(dispatch->data, "BackfaceCulling") == 0) {
-                if (strcmp(dispatch->value, "1") == 0) {
-                    backfaceculling = true;
-                } else if (strcmp(dispatch->value, "0") == 0) {
-                    backfaceculling = false;
-                } else {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            } else if (strcmp(dispatch->data, "UseZBuffer") == 0) {
-                if (strcmp(dispatch->value, "1") == 0) {
-                    usezbuffer = true;
-                } else if (strcmp(dispatch->value, "0") == 0) {
-                    usezbuffer = false;
-                } else {
-                    errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
-                }
-            }
-        }
+    getrenderstats_ctx(&defaultcontext, stats);
+}
+
+void getrenderstats_ctx(const renderer_context * context, renderer_stats * stats)
+{
+    /* Statistics of the last rendersurface and save on this context, times are wall-clock milliseconds */
+    *stats = context->stats;
+}
+
+int opentracefile(const char * filename)
+{
+    /* Tracing is process-wide and may be turned on and off while other threads render, zones that straddle it are dropped */
+    runonce(&tracemutexonce, initializetracemutex);
+    lockmutex(&tracemutex);
+    if (tracefile != NULL) {
+        unlockmutex(&tracemutex);
+        return RENDERER_ERROR_INVALIDVALUE;
     }
-    return 0;
+    FILE * filepointer = fopen(filename, "wb");
+    if (filepointer == NULL) {
+        unlockmutex(&tracemutex);
+        return RENDERER_ERROR_FILEOPENFAILED;
+    }
+    if (fputs("{\"traceEvents\":[", filepointer) == EOF) {
+        fclose(filepointer);
+        unlockmutex(&tracemutex);
+        return RENDERER_ERROR_FILEWRITEFAILED;
+    }
+    tracestart = getmilliseconds();
+    tracegeneration += 1U;
+    traceeventwritten = false;
+    tracewritefailed = false;
+    memset(tracethreadslots, 0, sizeof tracethreadslots);
+    traceoverflowthreads = 0U;
+    storetracefile(filepointer);
+    unlockmutex(&tracemutex);
+    return RENDERER_ERROR_NONE;
 }
 
-static float degreetoradian(float degree)
+int closetracefile(void)
 {
-    return degree * 3.14159265F / 180.F;
+    runonce(&tracemutexonce, initializetracemutex);
+    lockmutex(&tracemutex);
+    if (tracefile == NULL) {
+        unlockmutex(&tracemutex);
+        return RENDERER_ERROR_INVALIDVALUE;
+    }
+    int error = RENDERER_ERROR_NONE;
+    if (fputs("\n],\"displayTimeUnit\":\"ms\"}\n", tracefile) == EOF || tracewritefailed) {
+        error = RENDERER_ERROR_FILEWRITEFAILED;
+    }
+    if (fclose(tracefile) == EOF && error == RENDERER_ERROR_NONE) {
+        error = RENDERER_ERROR_FILECLOSEFAILED;
+    }
+    storetracefile(NULL);
+    unlockmutex(&tracemutex);
+    return error;
 }
 
-static bool ishexadecimalcharacter(char character)
+renderer_batch * createrendererbatch(const triangles * rawtriangles, unsigned int workercount, unsigned int queuelength)
 {
-    return character == '0' || character == '1' || character == '2' || character == '3' || character == '4' || character == '5' || character == '6' || character == '7' || character == '8' || character == '9'
-        || character == 'A' || character == 'B' || character == 'C' || character == 'D' || character == 'E' || character == 'F'
-        || character == 'a' || character == 'b' || character == 'c' || character == 'd' || character == 'e' || character == 'f';
+    return createrendererbatchstream(rawtriangles, workercount, queuelength, NULL);
 }
 
-static int hexadecimalcharactertovalue(char character)
+renderer_batch * createrendererbatchstream(const triangles * rawtriangles, unsigned int workercount, unsigned int queuelength, FILE * stream)
 {
-    switch (character) {
-    case '0':
-        errornumber = RENDERER_ERROR_NONE;
-        return 0;
-    case '1':
-        errornumber = RENDERER_ERROR_NONE;
-        return 1;
-    case '2':
-        errornumber = RENDERER_ERROR_NONE;
-        return 2;
-    case '3':
-        errornumber = RENDERER_ERROR_NONE;
-        return 3;
-    case '4':
-        errornumber = RENDERER_ERROR_NONE;
-        return 4;
-    case '5':
-        errornumber = RENDERER_ERROR_NONE;
-        return 5;
-    case '6':
-        errornumber = RENDERER_ERROR_NONE;
-        return 6;
-    case '7':
-        errornumber = RENDERER_ERROR_NONE;
-        return 7;
-    case '8':
-        errornumber = RENDERER_ERROR_NONE;
-        return 8;
-    case '9':
-        errornumber = RENDERER_ERROR_NONE;
-        return 9;
-    case 'A':
-    case 'a':
-        errornumber = RENDERER_ERROR_NONE;
-        return 10;
-    case 'B':
-    case 'b':
-        errornumber = RENDERER_ERROR_NONE;
-        return 11;
+    if (workercount == 0U || workercount > 256U || queuelength == 0U) {
+        return NULL;
+    }
+    renderer_batch * batch = calloc(1, sizeof(renderer_batch));
+    if (batch == NULL) {
+        return NULL;
+    }
+    batch->rawtriangles = rawtriangles;
+    batch->stream = stream;
+    batch->workercount = workercount;
+    batch->pendingcapacity = queuelength;
+
+    /* Two surfaces per render worker let encoding of one frame overlap rendering of the next */
+    batch->surfacecapacity = (size_t)workercount * 2;
+    batch->errornumber = RENDERER_ERROR_NONE;
+    batch->workers = calloc((size_t)workercount * 2, sizeof(batchworker));
+    batch->pending = malloc(batch->pendingcapacity * sizeof(batchframe));
+    batch->finished = malloc(batch->surfacecapacity * sizeof(batchframe));
+    batch->freesurfaces = malloc(batch->surfacecapacity * sizeof(surface *));
+    if (batch->workers == NULL || batch->pending == NULL || batch->finished == NULL || batch->freesurfaces == NULL) {
+        free(batch->freesurfaces);
+        free(batch->finished);
+        free(batch->pending);
+        free(batch->workers);
+        free(batch);
+        return NULL;
+    }
+    initializemutex(&batch->mutex);
+    initializeconditionvariable(&batch->changed);
+
+    /* The first half of the workers render, the second half encode */
+    bool started = true;
+    lockmutex(&batch->mutex);
+    for (size_t workerindex = 0; workerindex < batch->workercount * 2 && started; workerindex += 1) {
+        batchworker * worker = &batch->workers[workerindex];
+        worker->batch = batch;
+        worker->context = createrenderercontext();
+        started = worker->context != NULL && startthread(&worker->thread, workerindex < batch->workercount ? batchrenderworker : batchencodeworker, worker);
+        worker->started = started;
+        if (started && workerindex < batch->workercount) {
+            batch->runningrenderers += 1;
+        }
+    }
+    unlockmutex(&batch->mutex);
+    if (!started) {
+        finishrendererbatch(&batch);
+        return NULL;
+    }
+    return batch;
+}
+
+int submitbatchframe(renderer_batch * batch, const configurations * configstruct, const char * filename)
+{
+    /* Frames of a stream batch go to its stream in submission order and have no file name */
+    if (configstruct == NULL || (filename == NULL && batch->stream == NULL)) {
+        return RENDERER_ERROR_INVALIDVALUE;
+    }
+    char * filenamecopy = NULL;
+    if (filename != NULL) {
+        size_t length = strlen(filename);
+        filenamecopy = malloc(length + 1);
+        if (filenamecopy == NULL) {
+            return RENDERER_ERROR_INSUFFICIENTMEMORY;
+        }
+        memcpy(filenamecopy, filename, length + 1);
+    }
+
+    /* Blocks while the queue is full, so at most queuelength frames wait at a time */
+    lockmutex(&batch->mutex);
+    while (batch->pendingcount == batch->pendingcapacity && batch->errornumber == RENDERER_ERROR_NONE) {
+        waitconditionvariable(&batch->changed, &batch->mutex);
+    }
+    int error = batch->errornumber;
+    if (error == RENDERER_ERROR_NONE) {
+        batchframe * frame = &batch->pending[(batch->pendingfirst + batch->pendingcount) % batch->pendingcapacity];
+        frame->configuration = *configstruct;
+        frame->filename = filenamecopy;
+        frame->sequence = batch->submittedcount;
+        frame->target = NULL;
+        batch->submittedcount += 1;
+        batch->pendingcount += 1;
+        broadcastconditionvariable(&batch->changed);
+    }
+    unlockmutex(&batch->mutex);
+    if (error != RENDERER_ERROR_NONE) {
+        free(filenamecopy);
+    }
+    return error;
+}
+
+int finishrendererbatch(renderer_batch * * batch)
+{
+    if (*batch == NULL) {
+        return RENDERER_ERROR_INVALIDVALUE;
+    }
+    renderer_batch * b = *batch;
+    lockmutex(&b->mutex);
+    b->closing = true;
+    broadcastconditionvariable(&b->changed);
+    unlockmutex(&b->mutex);
+    for (size_t workerindex = 0; workerindex < b->workercount * 2; workerindex += 1) {
+        if (b->workers[workerindex].started) {
+            jointhread(&b->workers[workerindex].thread);
+        }
+        releaserenderercontext(&b->workers[workerindex].context);
+    }
+
+    /* Frames still queued after a failure are dropped */
+    for (; b->pendingcount != 0; b->pendingcount -= 1) {
+        free(b->pending[b->pendingfirst].filename);
+        b->pendingfirst = (b->pendingfirst + 1) % b->pendingcapacity;
+    }
+    for (size_t surfaceindex = 0; surfaceindex < b->freesurfacecount; surfaceindex += 1) {
+        releasesurface(&b->freesurfaces[surfaceindex]);
+    }
+    if (b->stream != NULL && fflush(b->stream) == EOF) {
+        setbatcherror(b, RENDERER_ERROR_FILEWRITEFAILED);
+    }
+    int error = b->errornumber;
+    destroyconditionvariable(&b->changed);
+    destroymutex(&b->mutex);
+    free(b->freesurfaces);
+    free(b->finished);
+    free(b->pending);
+    free(b->workers);
+    free(b);
+    *batch = NULL;
+    return error;
+}
+
+static bool isfileuptodate(const char * filename, const char * sourcefilename)
+{
+    /* Whole-second times can tie with an edit made right after the conversion, so size and full-resolution time must both match */
+    FILE * filepointer = fopen(filename, "rb");
+    if (filepointer == NULL) {
+        return false;
+    }
+    binaryheader header;
+    bool valid = fread(&header, sizeof header, 1, filepointer) == 1 && memcmp(header.magic, BINARY_MAGIC, sizeof header.magic) == 0 && header.version == BINARY_VERSION;
+    fclose(filepointer);
+    if (!valid) {
+        return false;
+    }
+    uint64_t sourcesize;
+    uint64_t sourcemodified;
+    if (!getfilestamp(sourcefilename, &sourcesize, &sourcemodified)) {
+        return false;
+    }
+    return header.sourcemodified != 0 && header.sourcesize == sourcesize && header.sourcemodified == sourcemodified;
+}
+
+static bool getfilestamp(const char * filename, uint64_t * size, uint64_t * modified)
+{
+    /* Modification time in the platform's finest unit, only ever compared with a stamp taken on the same platform */
+#if defined(_WIN32)
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (!GetFileAttributesExA(filename, GetFileExInfoStandard, &attributes)) {
+        return false;
+    }
+    *size = (uint64_t)attributes.nFileSizeHigh << 32 | attributes.nFileSizeLow;
+    *modified = (uint64_t)attributes.ftLastWriteTime.dwHighDateTime << 32 | attributes.ftLastWriteTime.dwLowDateTime;
+#else
+    struct stat status;
+    if (stat(filename, &status) != 0) {
+        return false;
+    }
+    *size = (uint64_t)status.st_size;
+#if defined(__APPLE__) && defined(__MACH__)
+    *modified = (uint64_t)status.st_mtimespec.tv_sec * UINT64_C(1000000000) + (uint64_t)status.st_mtimespec.tv_nsec;
+#else
+    *modified = (uint64_t)status.st_mtim.tv_sec * UINT64_C(1000000000) + (uint64_t)status.st_mtim.tv_nsec;
+#endif
+#endif
+    return true;
+}
+
+static bool isbinaryheadervalid(const binaryheader * header, size_t filesize)
+{
+    /* A file written with the other byte order fails the version and stride checks, counts are bounded before any offset arithmetic */
+    if (memcmp(header->magic, BINARY_MAGIC, sizeof header->magic) != 0 || header->version != BINARY_VERSION || header->stride != sizeof(triangle) ||
+        header->size > UINT32_MAX / 3 || header->vertexcount > header->size * 3 || header->nodecount > header->size * 2 + 1 || header->bvhtriangleoffset > filesize) {
+        return false;
+    }
+    uint64_t offsets[5] = {header->dataoffset, header->vertexoffset, header->indexoffset, header->nodeoffset, header->bvhtriangleoffset};
+    uint64_t sizes[4] = {header->size * sizeof(triangle), header->vertexcount * 4 * sizeof(float), header->size * 3 * sizeof(uint32_t), header->nodecount * sizeof(bvhnode)};
+    uint64_t end = sizeof(binaryheader);
+    for (size_t section = 0; section < 5; section += 1) {
+        if (offsets[section] < end || offsets[section] > header->bvhtriangleoffset || offsets[section] % 16U != 0U) {
+            return false;
+        }
+        end = section < 4 ? offsets[section] + sizes[section] : end;
+    }
+    return getbinaryfilesize(header) == filesize;
+}
+
+static uint64_t getbinaryfilesize(const binaryheader * header)
+{
+    /* Only a mesh with a hierarchy has its triangles in hierarchy order */
+    return header->bvhtriangleoffset + (header->nodecount != 0 ? header->size * sizeof(uint32_t) : 0);
+}
+
+static uint64_t alignbinaryoffset(uint64_t offset)
+{
+    return (offset + 15U) / 16U * 16U;
+}
+
+static bool writebinarysection(FILE * filepointer, uint64_t * position, uint64_t offset, const void * data, size_t size)
+{
+    /* Pads with zeros from position up to offset, then writes the section */
+    static const unsigned char padding[16] = {0};
+    if (offset > *position && fwrite(padding, (size_t)(offset - *position), 1, filepointer) != 1) {
+        return false;
+    }
+    if (size != 0 && fwrite(data, size, 1, filepointer) != 1) {
+        return false;
+    }
+    *position = offset + size;
+    return true;
+}
+
+static bool openmappedfile(mappedfile * file, const char * filename, bool copyonwrite)
+{
+    file->data = NULL;
+    file->size = 0;
+    file->buffer = NULL;
+#if defined(_WIN32)
+    file->mapping = NULL;
+    file->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file->file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER filesize;
+    if (GetFileSizeEx(file->file, &filesize) && (unsigned long long)filesize.QuadPart <= (size_t)-1) {
+        file->size = (size_t)filesize.QuadPart;
+        if (file->size == 0) {
+            return true;
+        }
+        file->mapping = CreateFileMappingA(file->file, NULL, copyonwrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, NULL);
+        if (file->mapping != NULL) {
+            file->data = MapViewOfFile(file->mapping, copyonwrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+            if (file->data != NULL) {
+                return true;
+            }
+            CloseHandle(file->mapping);
+            file->mapping = NULL;
+        }
+    }
+    CloseHandle(file->file);
+    file->file = INVALID_HANDLE_VALUE;
+#else
+    int descriptor = open(filename, O_RDONLY);
+    if (descriptor == -1) {
+        return false;
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) && (unsigned long long)status.st_size <= (size_t)-1) {
+        file->size = (size_t)status.st_size;
+        if (file->size == 0) {
+            close(descriptor);
+            return true;
+        }
+        void * mapping = mmap(NULL, file->size, copyonwrite ? PROT_READ | PROT_WRITE : PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping != MAP_FAILED) {
+            close(descriptor);
+            file->data = mapping;
+            return true;
+        }
+    }
+    close(descriptor);
+#endif
+
+    /* Files that cannot be mapped are read into memory instead */
+    FILE * filepointer = fopen(filename, "rb");
+    if (filepointer == NULL) {
+        return false;
+    }
+    size_t capacity = 65536;
+    file->size = 0;
+    for (;;) {
+        char * newbuffer = realloc(file->buffer, capacity);
+        if (newbuffer == NULL) {
+            free(file->buffer);
+            file->buffer = NULL;
+            fclose(filepointer);
+            return false;
+        }
+        file->buffer = newbuffer;
+        file->size += fread(file->buffer + file->size, 1, capacity - file->size, filepointer);
+        if (file->size < capacity) {
+            break;
+        }
+        capacity *= 2;
+    }
+    if (ferror(filepointer)) {
+        free(file->buffer);
+        file->buffer = NULL;
+        fclose(filepointer);
+        return false;
+    }
+    fclose(filepointer);
+    file->data = file->buffer;
+    return true;
+}
+
+static bool closemappedfile(mappedfile * file)
+{
+    bool succeeded = true;
+    if (file->buffer != NULL) {
+        free(file->buffer);
+    }
+#if defined(_WIN32)
+    else if (file->file != INVALID_HANDLE_VALUE) {
+        if (file->data != NULL && !UnmapViewOfFile(file->data)) {
+            succeeded = false;
+        }
+        if (file->mapping != NULL && !CloseHandle(file->mapping)) {
+            succeeded = false;
+        }
+        if (!CloseHandle(file->file)) {
+            succeeded = false;
+        }
+    }
+#else
+    else if (file->data != NULL && munmap((void *)file->data, file->size) != 0) {
+        succeeded = false;
+    }
+#endif
+    file->data = NULL;
+    file->size = 0;
+    file->buffer = NULL;
+    return succeeded;
+}
+
+static void countrawchunklines(void * argument)
+{
+    rawchunk * chunk = argument;
+    tracezone zone;
+    begintracezone(&zone, "count lines");
+    chunk->linecount = 0;
+    const char * cursor = chunk->start;
+    while (cursor < chunk->end) {
+        const char * newline = memchr(cursor, '\n', (size_t)(chunk->end - cursor));
+        chunk->linecount += 1;
+        if (newline == NULL) {
+            break;
+        }
+        cursor = newline + 1;
+    }
+    endtracezone(&zone);
+}
+
+static void parserawchunk(void * argument)
+{
+    rawchunk * chunk = argument;
+    tracezone zone;
+    begintracezone(&zone, "parse lines");
+    const char * cursor = chunk->start;
+    while (cursor < chunk->end) {
+        const char * lineend = memchr(cursor, '\n', (size_t)(chunk->end - cursor));
+        if (lineend == NULL) {
+            lineend = chunk->end;
+        }
+        if (lineend - cursor >= RAW_LINE_LENGTH) {
+            chunk->linetoolong = true;
+            return;
+        }
+        if (lineend != cursor && parserawtriangle(cursor, lineend, &chunk->data[chunk->offset + chunk->loaded])) {
+            chunk->loaded += 1;
+        }
+        cursor = lineend + 1;
+    }
+    endtracezone(&zone);
+}
+
+static bool parserawtriangle(const char * cursor, const char * end, triangle * newtriangle)
+{
+    float values[9];
+    for (size_t valueindex = 0; valueindex < 9; valueindex += 1) {
+        while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r' || *cursor == '\v' || *cursor == '\f')) {
+            cursor += 1;
+        }
+        cursor = parsefloat(cursor, end, &values[valueindex]);
+        if (cursor == NULL) {
+            return false;
+        }
+    }
+    newtriangle->v1.x = values[0];
+    newtriangle->v1.y = values[1];
+    newtriangle->v1.z = values[2];
+    newtriangle->w1 = 1.F;
+    newtriangle->v2.x = values[3];
+    newtriangle->v2.y = values[4];
+    newtriangle->v2.z = values[5];
+    newtriangle->w2 = 1.F;
+    newtriangle->v3.x = values[6];
+    newtriangle->v3.y = values[7];
+    newtriangle->v3.z = values[8];
+    newtriangle->w3 = 1.F;
+    return true;
+}
+
+static const char * parsefloat(const char * cursor, const char * end, float * value)
+{
+    static const double powersoften[23] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const char * start = cursor;
+    bool negative = false;
+    if (cursor < end && (*cursor == '+' || *cursor == '-')) {
+        negative = *cursor == '-';
+        cursor += 1;
+    }
+
+    /* Decimal numbers with at most 15 significant digits and a small exponent are converted exactly in double precision */
+    uint64_t mantissa = 0;
+    int significantdigits = 0;
+    int exponent = 0;
+    bool hasdigits = false;
+    while (cursor < end && *cursor >= '0' && *cursor <= '9') {
+        mantissa = mantissa * 10 + (uint64_t)(*cursor - '0');
+        significantdigits += mantissa != 0 ? 1 : 0;
+        hasdigits = true;
+        cursor += 1;
+    }
+    if (cursor < end && *cursor == '.') {
+        cursor += 1;
+        while (cursor < end && *cursor >= '0' && *cursor <= '9') {
+            mantissa = mantissa * 10 + (uint64_t)(*cursor - '0');
+            significantdigits += mantissa != 0 ? 1 : 0;
+            exponent -= 1;
+            hasdigits = true;
+            cursor += 1;
+        }
+    }
+    bool fastpath = hasdigits && significantdigits <= 15 && !(cursor < end && (*cursor == 'x' || *cursor == 'X'));
+    if (hasdigits && cursor < end && (*cursor == 'e' || *cursor == 'E')) {
+        /* Like sscanf(), an exponent marker without digits is consumed and ignored */
+        cursor += 1;
+        bool negativeexponent = false;
+        if (cursor < end && (*cursor == '+' || *cursor == '-')) {
+            negativeexponent = *cursor == '-';
+            cursor += 1;
+        }
+        int exponentvalue = 0;
+        while (cursor < end && *cursor >= '0' && *cursor <= '9') {
+            if (exponentvalue < 10000) {
+                exponentvalue = exponentvalue * 10 + (*cursor - '0');
+            }
+            cursor += 1;
+        }
+        exponent += negativeexponent ? -exponentvalue : exponentvalue;
+    }
+    if (fastpath && exponent >= -22 && exponent <= 22) {
+        double result = (double)mantissa;
+        result = exponent < 0 ? result / powersoften[-exponent] : result * powersoften[exponent];
+        uint64_t bits;
+        memcpy(&bits, &result, sizeof bits);
+
+        /* Rounding twice is only ambiguous exactly halfway between two floats */
+        if (result == 0. || (result >= FLT_MIN && result <= FLT_MAX && (bits & 0x1FFFFFFFU) != 0x10000000U)) {
+            *value = (float)(negative ? -result : result);
+            return cursor;
+        }
+    } else if (!hasdigits && cursor < end && *cursor != 'i' && *cursor != 'I' && *cursor != 'n' && *cursor != 'N') {
+        return NULL;
+    }
+
+    /* Everything else (long mantissas, huge exponents, infinities and NaNs) goes through strtof() like sscanf() does */
+    char token[RAW_LINE_LENGTH];
+    size_t length = (size_t)(end - start) < RAW_LINE_LENGTH - 1 ? (size_t)(end - start) : RAW_LINE_LENGTH - 1;
+    memcpy(token, start, length);
+    token[length] = '\0';
+    char * tokenend;
+    *value = strtof(token, &tokenend);
+    if (tokenend == token) {
+        return NULL;
+    }
+    return start + (tokenend - token);
+}
+
+static int inicallback(IniDispatch * dispatch, void * user_data)
+{
+    renderer_context * context = user_data;
+    if (dispatch->type == INI_SECTION) {
+        const char * source = dispatch->data;
+        for (size_t i = 0; i < 64; i += 1) {
+            context->inisection[i] = *source;
+            if (*source == '\0') {
+                break;
+            } else if (i == 63) {
+                context->inisection[i] = '\0';
+            } else {
+                source += 1;
+            }
+        }
+    } else if (dispatch->type == INI_KEY) {
+        if (strcmp(context->inisection, "Renderer") == 0) {
+            applyconfiguration(context, dispatch->data, dispatch->value);
+        }
+    }
+    return 0;
+}
+
+static bool applyconfiguration(renderer_context * context, const char * key, const char * value)
+{
+    if (strcmp(key, "LightSourcePositionX") == 0) {
+        if (sscanf(value, "%f", &context->lightsourceposition.x) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "LightSourcePositionY") == 0) {
+        if (sscanf(value, "%f", &context->lightsourceposition.y) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "LightSourcePositionZ") == 0) {
+        if (sscanf(value, "%f", &context->lightsourceposition.z) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "CameraPositionX") == 0) {
+        if (sscanf(value, "%f", &context->cameraposition.x) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "CameraPositionY") == 0) {
+        if (sscanf(value, "%f", &context->cameraposition.y) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "CameraPositionZ") == 0) {
+        if (sscanf(value, "%f", &context->cameraposition.z) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "CameraLookAtPointX") == 0) {
+        if (sscanf(value, "%f", &context->cameralookatpoint.x) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "CameraLookAtPointY") == 0) {
+        if (sscanf(value, "%f", &context->cameralookatpoint.y) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "CameraLookAtPointZ") == 0) {
+        if (sscanf(value, "%f", &context->cameralookatpoint.z) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "UpVectorX") == 0) {
+        if (sscanf(value, "%f", &context->up.x) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "UpVectorY") == 0) {
+        if (sscanf(value, "%f", &context->up.y) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "UpVectorZ") == 0) {
+        if (sscanf(value, "%f", &context->up.z) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "ObjectPositionX") == 0) {
+        if (sscanf(value, "%f", &context->objectposition.x) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "ObjectPositionY") == 0) {
+        if (sscanf(value, "%f", &context->objectposition.y) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "ObjectPositionZ") == 0) {
+        if (sscanf(value, "%f", &context->objectposition.z) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "ObjectRotationX") == 0) {
+        if (sscanf(value, "%f", &context->objectrotationxdegree) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else {
+            context->objectrotationx = degreetoradian(context->objectrotationxdegree);
+        }
+    } else if (strcmp(key, "ObjectRotationY") == 0) {
+        if (sscanf(value, "%f", &context->objectrotationydegree) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else {
+            context->objectrotationy = degreetoradian(context->objectrotationydegree);
+        }
+    } else if (strcmp(key, "ObjectRotationZ") == 0) {
+        if (sscanf(value, "%f", &context->objectrotationzdegree) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else {
+            context->objectrotationz = degreetoradian(context->objectrotationzdegree);
+        }
+    } else if (strcmp(key, "ObjectScalingX") == 0) {
+        if (sscanf(value, "%f", &context->objectscalingx) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "ObjectScalingY") == 0) {
+        if (sscanf(value, "%f", &context->objectscalingy) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "ObjectScalingZ") == 0) {
+        if (sscanf(value, "%f", &context->objectscalingz) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "FieldOfView") == 0) {
+        if (sscanf(value, "%f", &context->fieldofviewdegree) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else if (context->fieldofviewdegree < 0.F || context->fieldofviewdegree > 180.F) {
+            context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        } else {
+            context->fieldofview = degreetoradian(context->fieldofviewdegree);
+        }
+    } else if (strcmp(key, "zNear") == 0) {
+        if (sscanf(value, "%f", &context->znear) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else if (context->znear < FLT_EPSILON) {
+            context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        }
+    } else if (strcmp(key, "zFar") == 0) {
+        if (sscanf(value, "%f", &context->zfar) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else if (context->zfar < FLT_EPSILON) {
+            context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        }
+    } else if (strcmp(key, "OutputWidth") == 0) {
+        if (sscanf(value, "%u", &context->outputwidth) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else if (context->outputwidth == 0U || context->outputwidth > 32767U) {
+            context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        }
+    } else if (strcmp(key, "OutputHeight") == 0) {
+        if (sscanf(value, "%u", &context->outputheight) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else if (context->outputheight == 0U || context->outputheight > 32767U) {
+            context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        }
+    } else if (strcmp(key, "MaterialDiffuseReflectance") == 0) {
+        if (strlen(value) != 7 || value[0] != '#' || !ishexadecimalcharacter(value[1]) || !ishexadecimalcharacter(value[2]) || !ishexadecimalcharacter(value[3]) || !ishexadecimalcharacter(value[4]) || !ishexadecimalcharacter(value[5]) || !ishexadecimalcharacter(value[6])) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else {
+            context->materialdiffusereflectancered = hexadecimalcharactertovalue(value[1]) * 16 + hexadecimalcharactertovalue(value[2]);
+            context->materialdiffusereflectancegreen = hexadecimalcharactertovalue(value[3]) * 16 + hexadecimalcharactertovalue(value[4]);
+            context->materialdiffusereflectanceblue = hexadecimalcharactertovalue(value[5]) * 16 + hexadecimalcharactertovalue(value[6]);
+            context->materialdiffusereflectance.red = context->materialdiffusereflectancered / 255.0F;
+            context->materialdiffusereflectance.green = context->materialdiffusereflectancegreen / 255.0F;
+            context->materialdiffusereflectance.blue = context->materialdiffusereflectanceblue / 255.0F;
+        }
+    } else if (strcmp(key, "BackfaceCulling") == 0) {
+        if (strcmp(value, "1") == 0) {
+            context->backfaceculling = true;
+        } else if (strcmp(value, "0") == 0) {
+            context->backfaceculling = false;
+        } else {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "UseZBuffer") == 0) {
+        if (strcmp(value, "1") == 0) {
+            context->usezbuffer = true;
+        } else if (strcmp(value, "0") == 0) {
+            context->usezbuffer = false;
+        } else {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "FrontToBackSort") == 0) {
+        if (strcmp(value, "1") == 0) {
+            context->fronttobacksort = true;
+        } else if (strcmp(value, "0") == 0) {
+            context->fronttobacksort = false;
+        } else {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "RenderThreads") == 0) {
+        if (sscanf(value, "%u", &context->renderthreads) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else if (context->renderthreads > 256U) {
+            context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        }
+    } else if (strcmp(key, "AntiAliasing") == 0) {
+        if (strcmp(value, "Off") == 0) {
+            context->antialiasing = 1U;
+        } else if (strcmp(value, "2x2") == 0) {
+            context->antialiasing = 2U;
+        } else if (strcmp(value, "3x3") == 0) {
+            context->antialiasing = 3U;
+        } else if (strcmp(value, "4x4") == 0) {
+            context->antialiasing = 4U;
+        } else {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "PngCompressionLevel") == 0) {
+        if (sscanf(value, "%d", &context->pngcompressionlevel) != 1) {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        } else if (context->pngcompressionlevel < 0 || context->pngcompressionlevel > 9) {
+            context->errornumber = RENDERER_ERROR_INVALIDVALUE;
+        }
+    } else if (strcmp(key, "PngFilter") == 0) {
+        if (strcmp(value, "None") == 0) {
+            context->pngfilter = RENDERER_PNG_FILTER_NONE;
+        } else if (strcmp(value, "Sub") == 0) {
+            context->pngfilter = RENDERER_PNG_FILTER_SUB;
+        } else if (strcmp(value, "Up") == 0) {
+            context->pngfilter = RENDERER_PNG_FILTER_UP;
+        } else if (strcmp(value, "Average") == 0) {
+            context->pngfilter = RENDERER_PNG_FILTER_AVERAGE;
+        } else if (strcmp(value, "Paeth") == 0) {
+            context->pngfilter = RENDERER_PNG_FILTER_PAETH;
+        } else if (strcmp(value, "Adaptive") == 0) {
+            context->pngfilter = RENDERER_PNG_FILTER_ADAPTIVE;
+        } else {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "PngParallelDeflate") == 0) {
+        if (strcmp(value, "1") == 0) {
+            context->pngparalleldeflate = true;
+        } else if (strcmp(value, "0") == 0) {
+            context->pngparalleldeflate = false;
+        } else {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else if (strcmp(key, "OutputFormat") == 0) {
+        if (strcmp(value, "Auto") == 0) {
+            context->outputformat = RENDERER_OUTPUT_FORMAT_AUTO;
+        } else if (strcmp(value, "PNG") == 0) {
+            context->outputformat = RENDERER_OUTPUT_FORMAT_PNG;
+        } else if (strcmp(value, "PPM") == 0) {
+            context->outputformat = RENDERER_OUTPUT_FORMAT_PPM;
+        } else if (strcmp(value, "PAM") == 0) {
+            context->outputformat = RENDERER_OUTPUT_FORMAT_PAM;
+        } else if (strcmp(value, "QOI") == 0) {
+            context->outputformat = RENDERER_OUTPUT_FORMAT_QOI;
+        } else if (strcmp(value, "Raw") == 0) {
+            context->outputformat = RENDERER_OUTPUT_FORMAT_RAW;
+        } else {
+            context->errornumber = RENDERER_ERROR_CONFIGWRONGFORMAT;
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static float degreetoradian(float degree)
+{
+    return degree * 3.14159265F / 180.F;
+}
+
+static bool ishexadecimalcharacter(char character)
+{
+    return character == '0' || character == '1' || character == '2' || character == '3' || character == '4' || character == '5' || character == '6' || character == '7' || character == '8' || character == '9'
+        || character == 'A' || character == 'B' || character == 'C' || character == 'D' || character == 'E' || character == 'F'
+        || character == 'a' || character == 'b' || character == 'c' || character == 'd' || character == 'e' || character == 'f';
+}
+
+static int hexadecimalcharactertovalue(char character)
+{
+    switch (character) {
+    case '0':
+        return 0;
+    case '1':
+        return 1;
+    case '2':
+        return 2;
+    case '3':
+        return 3;
+    case '4':
+        return 4;
+    case '5':
+        return 5;
+    case '6':
+        return 6;
+    case '7':
+        return 7;
+    case '8':
+        return 8;
+    case '9':
+        return 9;
+    case 'A':
+    case 'a':
+        return 10;
+    case 'B':
+    case 'b':
+        return 11;
     case 'C':
     case 'c':
-        errornumber = RENDERER_ERROR_NONE;
         return 12;
     case 'D':
     case 'd':
-        errornumber = RENDERER_ERROR_NONE;
         return 13;
     case 'E':
     case 'e':
-        errornumber = RENDERER_ERROR_NONE;
         return 14;
     case 'F':
     case 'f':
-        errornumber = RENDERER_ERROR_NONE;
         return 15;
     default:
-        errornumber = RENDERER_ERROR_INVALIDVALUE;
         return -1;
     }
 }
@@ -1406,53 +2696,2349 @@ static void normalize(vector * v)
 
 static void calculatenewtransformationmatrix(float * t, const float * op)
 {
-    memcpy(previousmatrix, t, 16 * sizeof(float));
-    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, 4, 4, 4, 1.F, previousmatrix, 4, op, 4, 0.F, t, 4);
-}
-
-static void zsortingsubroutine(triangle * triangletable, light * lightingtable, intptr_t start, intptr_t end)
-{
-    if (start < end) {
-        triangle temptriangle;
-        light templight;
-        int randomnumber = rand();
-        intptr_t length = end + 1 - start;
-        if (length <= RAND_MAX) {
-            randomnumber %= length;
-        }
-        intptr_t pivot = start + randomnumber;
-        temptriangle = triangletable[pivot];
-        triangletable[pivot] = triangletable[end];
-        triangletable[end] = temptriangle;
-        templight = lightingtable[pivot];
-        lightingtable[pivot] = lightingtable[end];
-        lightingtable[end] = templight;
-        intptr_t left = start;
-        intptr_t right = end - 1;
-        while (left <= right) {
-            float zpivot = (triangletable[end].v1.z + triangletable[end].v2.z + triangletable[end].v3.z) / 3.F;
-            if ((triangletable[left].v1.z + triangletable[left].v2.z + triangletable[left].v3.z) / 3.F > zpivot) {
-                left += 1;
-            } else if ((triangletable[right].v1.z + triangletable[right].v2.z + triangletable[right].v3.z) / 3.F <= zpivot) {
-                right -= 1;
-            } else {
-                temptriangle = triangletable[left];
-                triangletable[left] = triangletable[right];
-                triangletable[right] = temptriangle;
-                templight = lightingtable[left];
-                lightingtable[left] = lightingtable[right];
-                lightingtable[right] = templight;
-                left += 1;
-                right -= 1;
+    float previousmatrix[16];
+    memcpy(previousmatrix, t, sizeof previousmatrix);
+    for (size_t row = 0; row < 4; row += 1) {
+        for (size_t column = 0; column < 4; column += 1) {
+            t[row * 4 + column] = previousmatrix[row * 4] * op[column] + previousmatrix[row * 4 + 1] * op[4 + column] + previousmatrix[row * 4 + 2] * op[8 + column] + previousmatrix[row * 4 + 3] * op[12 + column];
+        }
+    }
+}
+
+static indexedmesh * buildindexedmesh(const triangles * rawtriangles)
+{
+    if (rawtriangles->size > UINT32_MAX / 3) {
+        return NULL;
+    }
+    size_t maximumsize = rawtriangles->size * 3;
+    size_t tablesize = 16;
+    while (tablesize < maximumsize * 2) {
+        tablesize *= 2;
+    }
+    indexedmesh * mesh = malloc(sizeof(indexedmesh));
+    if (mesh == NULL) {
+        return NULL;
+    }
+    mesh->trianglecount = rawtriangles->size;
+    mesh->mapped = false;
+    mesh->nodes = NULL;
+    mesh->nodecount = 0;
+    mesh->bvhtriangles = NULL;
+    mesh->indices = malloc((maximumsize == 0 ? 1 : maximumsize) * sizeof(uint32_t));
+    uint32_t * table = malloc(tablesize * sizeof(uint32_t));
+    if (mesh->indices == NULL || table == NULL || !allocatevertexstreams(&mesh->vertices, maximumsize)) {
+        free(table);
+        free(mesh->indices);
+        free(mesh);
+        return NULL;
+    }
+
+    /* Merge bit-identical vertices through an open-addressing hash table, in order of first use */
+    memset(table, 0xFF, tablesize * sizeof(uint32_t));
+    const float * data = (const float *)rawtriangles->data;
+    size_t vertexcount = 0;
+    for (size_t vertexindex = 0; vertexindex < maximumsize; vertexindex += 1) {
+        const float * vertex = &data[vertexindex * 4];
+        uint32_t bits[4];
+        memcpy(bits, vertex, sizeof bits);
+        uint64_t hash = 0;
+        for (size_t component = 0; component < 4; component += 1) {
+            hash = (hash ^ bits[component]) * UINT64_C(0x9E3779B97F4A7C15);
+        }
+        size_t slot = (size_t)(hash ^ hash >> 32) & (tablesize - 1);
+        for (;;) {
+            uint32_t candidate = table[slot];
+            if (candidate == UINT32_MAX) {
+                candidate = (uint32_t)vertexcount;
+                table[slot] = candidate;
+                mesh->vertices.x[vertexcount] = vertex[0];
+                mesh->vertices.y[vertexcount] = vertex[1];
+                mesh->vertices.z[vertexcount] = vertex[2];
+                mesh->vertices.w[vertexcount] = vertex[3];
+                vertexcount += 1;
+                mesh->indices[vertexindex] = candidate;
+                break;
+            }
+            float candidatevertex[4] = {mesh->vertices.x[candidate], mesh->vertices.y[candidate], mesh->vertices.z[candidate], mesh->vertices.w[candidate]};
+            if (memcmp(candidatevertex, bits, sizeof bits) == 0) {
+                mesh->indices[vertexindex] = candidate;
+                break;
+            }
+            slot = (slot + 1) & (tablesize - 1);
+        }
+    }
+    free(table);
+
+    /* Pack the streams down to the unique vertex count */
+    if (vertexcount < maximumsize) {
+        memmove(mesh->vertices.x + vertexcount, mesh->vertices.y, vertexcount * sizeof(float));
+        memmove(mesh->vertices.x + vertexcount * 2, mesh->vertices.z, vertexcount * sizeof(float));
+        memmove(mesh->vertices.x + vertexcount * 3, mesh->vertices.w, vertexcount * sizeof(float));
+        float * shrunkvertices = realloc(mesh->vertices.x, (vertexcount == 0 ? 1 : vertexcount) * 4 * sizeof(float));
+        if (shrunkvertices != NULL) {
+            mesh->vertices.x = shrunkvertices;
+        }
+        mesh->vertices.size = vertexcount;
+        mesh->vertices.y = mesh->vertices.x + vertexcount;
+        mesh->vertices.z = mesh->vertices.x + vertexcount * 2;
+        mesh->vertices.w = mesh->vertices.x + vertexcount * 3;
+    }
+    buildbvh(mesh);
+    return mesh;
+}
+
+static void releaseindexedmesh(indexedmesh * mesh)
+{
+    /* A mesh read from a binary file points into the triangles' mapping or buffer, which releasetriangles frees */
+    if (mesh != NULL) {
+        if (!mesh->mapped) {
+            releasevertexstreams(&mesh->vertices);
+            free(mesh->indices);
+            free(mesh->nodes);
+            free(mesh->bvhtriangles);
+        }
+        free(mesh);
+    }
+}
+
+static bool isindexedmeshvalid(const indexedmesh * mesh)
+{
+    /* Indices from a file are checked once so that a damaged file cannot make the pipeline read out of bounds */
+    for (size_t corner = 0; corner < mesh->trianglecount * 3; corner += 1) {
+        if (mesh->indices[corner] >= mesh->vertices.size) {
+            return false;
+        }
+    }
+    for (size_t nodeindex = 0; nodeindex < mesh->nodecount; nodeindex += 1) {
+        const bvhnode * node = &mesh->nodes[nodeindex];
+        if (node->next <= nodeindex || node->next > mesh->nodecount || node->first > mesh->trianglecount || node->count > mesh->trianglecount - node->first) {
+            return false;
+        }
+    }
+    for (size_t triangleindex = 0; triangleindex < mesh->trianglecount && mesh->nodecount != 0; triangleindex += 1) {
+        if (mesh->bvhtriangles[triangleindex] >= mesh->trianglecount) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void buildbvh(indexedmesh * mesh)
+{
+    /* The hierarchy is optional, without it every triangle goes through the vertex stage */
+    size_t trianglecount = mesh->trianglecount;
+    const vertexstreams * vertices = &mesh->vertices;
+    if (trianglecount == 0) {
+        return;
+    }
+    float minimum[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+    float maximum[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (size_t vertexindex = 0; vertexindex < vertices->size; vertexindex += 1) {
+        /* Boxes bound x, y and z, so only vertices with w equal to one can be culled by them */
+        if (vertices->w[vertexindex] != 1.F || !isfinite(vertices->x[vertexindex]) || !isfinite(vertices->y[vertexindex]) || !isfinite(vertices->z[vertexindex])) {
+            return;
+        }
+        float vertex[3] = {vertices->x[vertexindex], vertices->y[vertexindex], vertices->z[vertexindex]};
+        for (size_t axis = 0; axis < 3; axis += 1) {
+            minimum[axis] = vertex[axis] < minimum[axis] ? vertex[axis] : minimum[axis];
+            maximum[axis] = vertex[axis] > maximum[axis] ? vertex[axis] : maximum[axis];
+        }
+    }
+
+    /* Leaves hold at least half of BVH_LEAF_SIZE triangles, which bounds the node count */
+    size_t leafcount = (trianglecount + BVH_LEAF_SIZE / 2 - 1) / (BVH_LEAF_SIZE / 2);
+    uint32_t * keys = malloc(trianglecount * 2 * sizeof(uint32_t));
+    size_t * indices = malloc(trianglecount * 2 * sizeof(size_t));
+    radixsortchunk * chunk = malloc(sizeof(radixsortchunk));
+    mesh->bvhtriangles = malloc(trianglecount * sizeof(uint32_t));
+    mesh->nodes = malloc(leafcount * 2 * sizeof(bvhnode));
+    if (keys == NULL || indices == NULL || chunk == NULL || mesh->bvhtriangles == NULL || mesh->nodes == NULL) {
+        free(keys);
+        free(indices);
+        free(chunk);
+        free(mesh->bvhtriangles);
+        free(mesh->nodes);
+        mesh->bvhtriangles = NULL;
+        mesh->nodes = NULL;
+        return;
+    }
+
+    /* Triangles in Morton order of their centroids, so that ranges of the order are spatially compact */
+    float scale[3];
+    for (size_t axis = 0; axis < 3; axis += 1) {
+        float extent = maximum[axis] - minimum[axis];
+        scale[axis] = extent > 0.F ? (float)((1U << BVH_MORTON_BITS) - 1U) / extent : 0.F;
+    }
+    for (size_t triangleindex = 0; triangleindex < trianglecount; triangleindex += 1) {
+        const uint32_t * corners = &mesh->indices[triangleindex * 3];
+        float centroid[3] = {
+            (vertices->x[corners[0]] + vertices->x[corners[1]] + vertices->x[corners[2]]) / 3.F,
+            (vertices->y[corners[0]] + vertices->y[corners[1]] + vertices->y[corners[2]]) / 3.F,
+            (vertices->z[corners[0]] + vertices->z[corners[1]] + vertices->z[corners[2]]) / 3.F
+        };
+        uint32_t key = 0U;
+        for (size_t axis = 0; axis < 3; axis += 1) {
+            float cell = (centroid[axis] - minimum[axis]) * scale[axis];
+            cell = cell < 0.F ? 0.F : cell > (float)((1U << BVH_MORTON_BITS) - 1U) ? (float)((1U << BVH_MORTON_BITS) - 1U) : cell;
+            key |= spreadmortonbits((uint32_t)cell) << (2U - axis);
+        }
+        keys[triangleindex] = key;
+        indices[triangleindex] = triangleindex;
+    }
+    const size_t * order = radixsort(keys, indices, keys + trianglecount, indices + trianglecount, trianglecount, chunk, 1);
+    for (size_t triangleindex = 0; triangleindex < trianglecount; triangleindex += 1) {
+        mesh->bvhtriangles[triangleindex] = (uint32_t)order[triangleindex];
+    }
+    free(keys);
+    free(indices);
+    free(chunk);
+
+    /* Nodes in depth-first order, the boxes are grown by a margin that covers rounding in the plane tests */
+    mesh->nodecount = 0;
+    buildbvhnode(mesh, 0U, (uint32_t)trianglecount);
+    float margin = 0.F;
+    for (size_t axis = 0; axis < 3; axis += 1) {
+        margin = fabsf(minimum[axis]) > margin ? fabsf(minimum[axis]) : margin;
+        margin = fabsf(maximum[axis]) > margin ? fabsf(maximum[axis]) : margin;
+    }
+    margin *= 1e-5F;
+    for (size_t nodeindex = 0; nodeindex < mesh->nodecount; nodeindex += 1) {
+        for (size_t axis = 0; axis < 3; axis += 1) {
+            mesh->nodes[nodeindex].minimum[axis] -= margin;
+            mesh->nodes[nodeindex].maximum[axis] += margin;
+        }
+    }
+}
+
+static void buildbvhnode(indexedmesh * mesh, uint32_t first, uint32_t count)
+{
+    uint32_t nodeindex = (uint32_t)mesh->nodecount;
+    bvhnode * node = &mesh->nodes[nodeindex];
+    mesh->nodecount += 1;
+    node->first = first;
+    node->count = count;
+    if (count > BVH_LEAF_SIZE) {
+        /* Halving the Morton order splits at the highest differing bit for evenly spread triangles */
+        uint32_t left = (uint32_t)mesh->nodecount;
+        buildbvhnode(mesh, first, count / 2U);
+        uint32_t right = (uint32_t)mesh->nodecount;
+        buildbvhnode(mesh, first + count / 2U, count - count / 2U);
+        for (size_t axis = 0; axis < 3; axis += 1) {
+            node->minimum[axis] = mesh->nodes[left].minimum[axis] < mesh->nodes[right].minimum[axis] ? mesh->nodes[left].minimum[axis] : mesh->nodes[right].minimum[axis];
+            node->maximum[axis] = mesh->nodes[left].maximum[axis] > mesh->nodes[right].maximum[axis] ? mesh->nodes[left].maximum[axis] : mesh->nodes[right].maximum[axis];
+        }
+    } else {
+        const vertexstreams * vertices = &mesh->vertices;
+        for (size_t axis = 0; axis < 3; axis += 1) {
+            node->minimum[axis] = FLT_MAX;
+            node->maximum[axis] = -FLT_MAX;
+        }
+        for (uint32_t triangleindex = first; triangleindex < first + count; triangleindex += 1) {
+            const uint32_t * corners = &mesh->indices[(size_t)mesh->bvhtriangles[triangleindex] * 3];
+            for (size_t corner = 0; corner < 3; corner += 1) {
+                float vertex[3] = {vertices->x[corners[corner]], vertices->y[corners[corner]], vertices->z[corners[corner]]};
+                for (size_t axis = 0; axis < 3; axis += 1) {
+                    node->minimum[axis] = vertex[axis] < node->minimum[axis] ? vertex[axis] : node->minimum[axis];
+                    node->maximum[axis] = vertex[axis] > node->maximum[axis] ? vertex[axis] : node->maximum[axis];
+                }
+            }
+        }
+    }
+    node->next = (uint32_t)mesh->nodecount;
+}
+
+static uint32_t spreadmortonbits(uint32_t value)
+{
+    /* Moves bit i of a 10-bit value to bit 3i */
+    value = (value | value << 16) & 0x030000FFU;
+    value = (value | value << 8) & 0x0300F00FU;
+    value = (value | value << 4) & 0x030C30C3U;
+    return (value | value << 2) & 0x09249249U;
+}
+
+static bool allocatevertexstreams(vertexstreams * vertices, size_t size)
+{
+    vertices->size = size;
+    vertices->x = malloc((size == 0 ? 1 : size) * 4 * sizeof(float));
+    if (vertices->x == NULL) {
+        return false;
+    }
+    vertices->y = vertices->x + size;
+    vertices->z = vertices->x + size * 2;
+    vertices->w = vertices->x + size * 3;
+    return true;
+}
+
+static void releasevertexstreams(vertexstreams * vertices)
+{
+    free(vertices->x);
+    vertices->size = 0;
+    vertices->x = NULL;
+    vertices->y = NULL;
+    vertices->z = NULL;
+    vertices->w = NULL;
+}
+
+static void * allocatescratch(scratcharena * scratch, size_t size)
+{
+    /* Zero-sized requests still get a distinct non-null pointer */
+    size = size == 0 ? SCRATCH_ALIGNMENT : (size + SCRATCH_ALIGNMENT - 1) / SCRATCH_ALIGNMENT * SCRATCH_ALIGNMENT;
+    scratch->peak += size;
+    if (size <= scratch->capacity - scratch->used) {
+        void * memory = scratch->data + scratch->used;
+        scratch->used += size;
+        return memory;
+    }
+
+    /* Overflow blocks keep the pointer to the next one in front of the aligned memory */
+    char * block = malloc(size + SCRATCH_ALIGNMENT * 2);
+    if (block == NULL) {
+        return NULL;
+    }
+    *(void * *)block = scratch->overflow;
+    scratch->overflow = block;
+    return (void *)(((uintptr_t)block + SCRATCH_ALIGNMENT * 2 - 1) / SCRATCH_ALIGNMENT * SCRATCH_ALIGNMENT);
+}
+
+static void resetscratcharena(scratcharena * scratch)
+{
+    while (scratch->overflow != NULL) {
+        void * next = *(void * *)scratch->overflow;
+        free(scratch->overflow);
+        scratch->overflow = next;
+    }
+    if (scratch->peak > scratch->capacity) {
+        free(scratch->block);
+        scratch->capacity = scratch->peak + scratch->peak / 4;
+        scratch->block = malloc(scratch->capacity + SCRATCH_ALIGNMENT);
+        if (scratch->block == NULL) {
+            scratch->capacity = 0;
+        }
+        scratch->data = (char *)(((uintptr_t)scratch->block + SCRATCH_ALIGNMENT - 1) / SCRATCH_ALIGNMENT * SCRATCH_ALIGNMENT);
+    }
+    scratch->used = 0;
+    scratch->peak = 0;
+}
+
+static void releasescratcharena(scratcharena * scratch)
+{
+    scratch->peak = 0;
+    resetscratcharena(scratch);
+    free(scratch->block);
+    scratch->block = NULL;
+    scratch->data = NULL;
+    scratch->capacity = 0;
+}
+
+static bool reservetrianglestreams(trianglestreams * streams, size_t capacity)
+{
+    if (capacity <= streams->capacity) {
+        return true;
+    }
+    size_t newcapacity = streams->capacity * 2;
+    if (newcapacity < capacity) {
+        newcapacity = capacity;
+    }
+    light * newlighting = realloc(streams->lighting, newcapacity * sizeof(light));
+    if (newlighting == NULL) {
+        return false;
+    }
+    streams->lighting = newlighting;
+    float * newx = realloc(streams->x, newcapacity * 12 * sizeof(float));
+    if (newx == NULL) {
+        return false;
+    }
+
+    /* Spread the streams out to the new capacity, last stream first so none overwrites the next */
+    size_t count = streams->size * 3;
+    memmove(newx + newcapacity * 9, newx + streams->capacity * 9, count * sizeof(float));
+    memmove(newx + newcapacity * 6, newx + streams->capacity * 6, count * sizeof(float));
+    memmove(newx + newcapacity * 3, newx + streams->capacity * 3, count * sizeof(float));
+    streams->capacity = newcapacity;
+    streams->x = newx;
+    streams->y = newx + newcapacity * 3;
+    streams->z = newx + newcapacity * 6;
+    streams->w = newx + newcapacity * 9;
+    return true;
+}
+
+static void storetriangle(trianglestreams * streams, size_t triangleindex, const point * p1, const point * p2, const point * p3, const light * l)
+{
+    size_t index = triangleindex * 3;
+    streams->x[index] = p1->x;
+    streams->y[index] = p1->y;
+    streams->z[index] = p1->z;
+    streams->w[index] = 1.F;
+    streams->x[index + 1] = p2->x;
+    streams->y[index + 1] = p2->y;
+    streams->z[index + 1] = p2->z;
+    streams->w[index + 1] = 1.F;
+    streams->x[index + 2] = p3->x;
+    streams->y[index + 2] = p3->y;
+    streams->z[index + 2] = p3->z;
+    streams->w[index + 2] = 1.F;
+    streams->lighting[triangleindex] = *l;
+}
+
+static void releasetrianglestreams(trianglestreams * streams)
+{
+    free(streams->lighting);
+    free(streams->x);
+    streams->size = 0;
+    streams->capacity = 0;
+    streams->x = NULL;
+    streams->y = NULL;
+    streams->z = NULL;
+    streams->w = NULL;
+    streams->lighting = NULL;
+}
+
+static bool cullmeshfrustum(const indexedmesh * mesh, const float * clipmatrix, uint64_t * visiblemask)
+{
+    /* Model-space planes of the clip volume -w <= x <= w, -w <= y <= w and 0 <= z <= w, inside is a non-negative distance */
+    float planes[6][4];
+    for (size_t row = 0; row < 4; row += 1) {
+        const float * clip = &clipmatrix[row * 4];
+        planes[0][row] = clip[3] + clip[0];
+        planes[1][row] = clip[3] - clip[0];
+        planes[2][row] = clip[3] + clip[1];
+        planes[3][row] = clip[3] - clip[1];
+        planes[4][row] = clip[2];
+        planes[5][row] = clip[3] - clip[2];
+    }
+
+    /* Stackless traversal, a subtree is skipped when outside one plane and taken whole when inside all of them */
+    bool culled = false;
+    memset(visiblemask, 0, (mesh->trianglecount + 63) / 64 * sizeof(uint64_t));
+    size_t nodeindex = 0;
+    while (nodeindex < mesh->nodecount) {
+        const bvhnode * node = &mesh->nodes[nodeindex];
+        bool outside = false;
+        bool inside = true;
+        for (size_t plane = 0; plane < 6 && !outside; plane += 1) {
+            const float * p = planes[plane];
+            float nearest = p[3];
+            float farthest = p[3];
+            for (size_t axis = 0; axis < 3; axis += 1) {
+                nearest += p[axis] * (p[axis] > 0.F ? node->minimum[axis] : node->maximum[axis]);
+                farthest += p[axis] * (p[axis] > 0.F ? node->maximum[axis] : node->minimum[axis]);
+            }
+            outside = farthest < 0.F;
+            inside = inside && !(nearest < 0.F);
+        }
+        if (outside) {
+            culled = true;
+            nodeindex = node->next;
+        } else if (inside || node->next == nodeindex + 1) {
+            if (nodeindex == 0) {
+                return false;
+            }
+            for (uint32_t triangleindex = node->first; triangleindex < node->first + node->count; triangleindex += 1) {
+                uint32_t meshtriangle = mesh->bvhtriangles[triangleindex];
+                visiblemask[meshtriangle / 64] |= UINT64_C(1) << (meshtriangle % 64);
+            }
+            nodeindex = node->next;
+        } else {
+            nodeindex += 1;
+        }
+    }
+    return culled;
+}
+
+static size_t cullmeshtriangles(const indexedmesh * mesh, const uint32_t * indices, size_t trianglecount, const point * modelspacecameraposition, uint8_t * frontfacing, uint32_t * visibleindices, cullchunk * chunks, size_t chunkcount)
+{
+    if (chunkcount > trianglecount / PIPELINE_MINIMUM_CHUNK + 1) {
+        chunkcount = trianglecount / PIPELINE_MINIMUM_CHUNK + 1;
+    }
+    for (size_t chunkindex = 0; chunkindex < chunkcount; chunkindex += 1) {
+        chunks[chunkindex].mesh = mesh;
+        chunks[chunkindex].indices = indices;
+        chunks[chunkindex].modelspacecameraposition = modelspacecameraposition;
+        chunks[chunkindex].frontfacing = frontfacing;
+        chunks[chunkindex].visibleindices = visibleindices;
+        chunks[chunkindex].first = trianglecount * chunkindex / chunkcount;
+        chunks[chunkindex].last = trianglecount * (chunkindex + 1) / chunkcount;
+    }
+    runinparallel(countfrontfacingtriangles, chunks, sizeof(cullchunk), chunkcount);
+
+    /* Each chunk writes after the chunks before it, so the visible triangles keep their order */
+    size_t offset = 0;
+    for (size_t chunkindex = 0; chunkindex < chunkcount; chunkindex += 1) {
+        chunks[chunkindex].offset = offset;
+        offset += chunks[chunkindex].count;
+    }
+    runinparallel(writefrontfacingtriangles, chunks, sizeof(cullchunk), chunkcount);
+    return offset;
+}
+
+static void countfrontfacingtriangles(void * argument)
+{
+    cullchunk * chunk = argument;
+    const float * x = chunk->mesh->vertices.x;
+    const float * y = chunk->mesh->vertices.y;
+    const float * z = chunk->mesh->vertices.z;
+    const point * modelspacecameraposition = chunk->modelspacecameraposition;
+    chunk->count = 0;
+    for (size_t triangleindex = chunk->first; triangleindex < chunk->last; triangleindex += 1) {
+        uint32_t i1 = chunk->indices[triangleindex * 3];
+        uint32_t i2 = chunk->indices[triangleindex * 3 + 1];
+        uint32_t i3 = chunk->indices[triangleindex * 3 + 2];
+        vector v1 = {x[i2] - x[i1], y[i2] - y[i1], z[i2] - z[i1]};
+        vector v2 = {x[i3] - x[i1], y[i3] - y[i1], z[i3] - z[i1]};
+        vector surfacevector;
+        crossproduct(&surfacevector, &v1, &v2);
+        vector eyevector = {
+            modelspacecameraposition->x - (x[i1] + x[i2] + x[i3]) / 3.F,
+            modelspacecameraposition->y - (y[i1] + y[i2] + y[i3]) / 3.F,
+            modelspacecameraposition->z - (z[i1] + z[i2] + z[i3]) / 3.F
+        };
+        bool visible = dotproduct(&surfacevector, &eyevector) > FLT_EPSILON;
+        chunk->frontfacing[triangleindex] = visible;
+        chunk->count += visible;
+    }
+}
+
+static void writefrontfacingtriangles(void * argument)
+{
+    cullchunk * chunk = argument;
+    size_t offset = chunk->offset;
+    for (size_t triangleindex = chunk->first; triangleindex < chunk->last; triangleindex += 1) {
+        if (chunk->frontfacing[triangleindex]) {
+            memcpy(&chunk->visibleindices[offset * 3], &chunk->indices[triangleindex * 3], 3 * sizeof(uint32_t));
+            offset += 1;
+        }
+    }
+}
+
+static bool allocatetransformedvertices(transformedvertices * vertices, size_t size, scratcharena * scratch)
+{
+    vertices->size = size;
+    vertices->viewx = allocatescratch(scratch, size * (10 * sizeof(float) + sizeof(uint8_t)));
+    if (vertices->viewx == NULL) {
+        return false;
+    }
+    vertices->viewy = vertices->viewx + size;
+    vertices->viewz = vertices->viewx + size * 2;
+    vertices->clipx = vertices->viewx + size * 3;
+    vertices->clipy = vertices->viewx + size * 4;
+    vertices->clipz = vertices->viewx + size * 5;
+    vertices->clipw = vertices->viewx + size * 6;
+    vertices->ndcz = vertices->viewx + size * 7;
+    vertices->screenx = vertices->viewx + size * 8;
+    vertices->screeny = vertices->viewx + size * 9;
+    vertices->outcodes = (uint8_t *)(vertices->viewx + size * 10);
+    return true;
+}
+
+static void transformvertices(const vertexstreams * vertices, size_t first, size_t last, const float * modelview, const float * projection, float width, float height, transformedvertices * transformed)
+{
+    /* Row vectors times row-major matrices for vertices first to last - 1, view space is kept for lighting */
+    size_t index = first;
+
+    /* Clip-space bounds of the guard band, GUARD_BAND_SIZE samples beyond each edge of the viewport */
+    float guardbandx = 1.F + GUARD_BAND_SIZE / width;
+    float guardbandy = 1.F + GUARD_BAND_SIZE / height;
+#if defined(RENDERER_SIMD_X86)
+    __m128 widths = _mm_set1_ps(width);
+    __m128 heights = _mm_set1_ps(height);
+    __m128 negativeheights = _mm_set1_ps(-height);
+    __m128 zeros = _mm_setzero_ps();
+    __m128 guardbandxs = _mm_set1_ps(guardbandx);
+    __m128 guardbandys = _mm_set1_ps(guardbandy);
+    for (; index + 4 <= last; index += 4) {
+        __m128 vertex[4] = {_mm_loadu_ps(&vertices->x[index]), _mm_loadu_ps(&vertices->y[index]), _mm_loadu_ps(&vertices->z[index]), _mm_loadu_ps(&vertices->w[index])};
+        __m128 view[4] = {transformcomponentsse2(vertex, modelview, 0), transformcomponentsse2(vertex, modelview, 1), transformcomponentsse2(vertex, modelview, 2), transformcomponentsse2(vertex, modelview, 3)};
+        __m128 x = transformcomponentsse2(view, projection, 0);
+        __m128 y = transformcomponentsse2(view, projection, 1);
+        __m128 z = transformcomponentsse2(view, projection, 2);
+        __m128 w = transformcomponentsse2(view, projection, 3);
+        __m128 ndcx = _mm_div_ps(x, w);
+        __m128 ndcy = _mm_div_ps(y, w);
+        _mm_storeu_ps(&transformed->viewx[index], view[0]);
+        _mm_storeu_ps(&transformed->viewy[index], view[1]);
+        _mm_storeu_ps(&transformed->viewz[index], view[2]);
+        _mm_storeu_ps(&transformed->clipx[index], x);
+        _mm_storeu_ps(&transformed->clipy[index], y);
+        _mm_storeu_ps(&transformed->clipz[index], z);
+        _mm_storeu_ps(&transformed->clipw[index], w);
+        _mm_storeu_ps(&transformed->ndcz[index], _mm_div_ps(z, w));
+        _mm_storeu_ps(&transformed->screenx[index], _mm_add_ps(_mm_mul_ps(ndcx, widths), widths));
+        _mm_storeu_ps(&transformed->screeny[index], _mm_add_ps(_mm_mul_ps(ndcy, negativeheights), heights));
+
+        /* The negated comparisons put NaN coordinates outside */
+        __m128 negativew = _mm_sub_ps(zeros, w);
+        __m128i outcodes = _mm_and_si128(_mm_castps_si128(_mm_cmpnge_ps(x, negativew)), _mm_set1_epi32(OUTCODE_LEFT));
+        outcodes = _mm_or_si128(outcodes, _mm_and_si128(_mm_castps_si128(_mm_cmpnle_ps(x, w)), _mm_set1_epi32(OUTCODE_RIGHT)));
+        outcodes = _mm_or_si128(outcodes, _mm_and_si128(_mm_castps_si128(_mm_cmpnge_ps(y, negativew)), _mm_set1_epi32(OUTCODE_BOTTOM)));
+        outcodes = _mm_or_si128(outcodes, _mm_and_si128(_mm_castps_si128(_mm_cmpnle_ps(y, w)), _mm_set1_epi32(OUTCODE_TOP)));
+        outcodes = _mm_or_si128(outcodes, _mm_and_si128(_mm_castps_si128(_mm_cmpnge_ps(z, zeros)), _mm_set1_epi32(OUTCODE_NEAR)));
+        outcodes = _mm_or_si128(outcodes, _mm_and_si128(_mm_castps_si128(_mm_cmpnle_ps(z, w)), _mm_set1_epi32(OUTCODE_FAR)));
+        outcodes = _mm_or_si128(outcodes, _mm_and_si128(_mm_castps_si128(_mm_cmpngt_ps(w, zeros)), _mm_set1_epi32(OUTCODE_BEHIND)));
+        __m128 guardbandw = _mm_mul_ps(w, guardbandxs);
+        __m128 outsideguardband = _mm_or_ps(_mm_cmpnge_ps(x, _mm_sub_ps(zeros, guardbandw)), _mm_cmpnle_ps(x, guardbandw));
+        guardbandw = _mm_mul_ps(w, guardbandys);
+        outsideguardband = _mm_or_ps(outsideguardband, _mm_or_ps(_mm_cmpnge_ps(y, _mm_sub_ps(zeros, guardbandw)), _mm_cmpnle_ps(y, guardbandw)));
+        outcodes = _mm_or_si128(outcodes, _mm_and_si128(_mm_castps_si128(outsideguardband), _mm_set1_epi32(OUTCODE_GUARDBAND)));
+        outcodes = _mm_packus_epi16(_mm_packs_epi32(outcodes, outcodes), outcodes);
+        uint32_t packedoutcodes = (uint32_t)_mm_cvtsi128_si32(outcodes);
+        memcpy(&transformed->outcodes[index], &packedoutcodes, sizeof packedoutcodes);
+    }
+#endif
+    for (; index < last; index += 1) {
+        float vx = vertices->x[index];
+        float vy = vertices->y[index];
+        float vz = vertices->z[index];
+        float vw = vertices->w[index];
+        float viewx = vx * modelview[0] + vy * modelview[4] + vz * modelview[8] + vw * modelview[12];
+        float viewy = vx * modelview[1] + vy * modelview[5] + vz * modelview[9] + vw * modelview[13];
+        float viewz = vx * modelview[2] + vy * modelview[6] + vz * modelview[10] + vw * modelview[14];
+        float vieww = vx * modelview[3] + vy * modelview[7] + vz * modelview[11] + vw * modelview[15];
+        float x = viewx * projection[0] + viewy * projection[4] + viewz * projection[8] + vieww * projection[12];
+        float y = viewx * projection[1] + viewy * projection[5] + viewz * projection[9] + vieww * projection[13];
+        float z = viewx * projection[2] + viewy * projection[6] + viewz * projection[10] + vieww * projection[14];
+        float w = viewx * projection[3] + viewy * projection[7] + viewz * projection[11] + vieww * projection[15];
+        float ndcx = x / w;
+        float ndcy = y / w;
+        transformed->viewx[index] = viewx;
+        transformed->viewy[index] = viewy;
+        transformed->viewz[index] = viewz;
+        transformed->clipx[index] = x;
+        transformed->clipy[index] = y;
+        transformed->clipz[index] = z;
+        transformed->clipw[index] = w;
+        transformed->ndcz[index] = z / w;
+        transformed->screenx[index] = ndcx * width + width;
+        transformed->screeny[index] = ndcy * -height + height;
+        transformed->outcodes[index] = (uint8_t)getoutcode(x, y, z, w, guardbandx, guardbandy);
+    }
+}
+
+#if defined(RENDERER_SIMD_X86)
+static __m128 transformcomponentsse2(const __m128 * vertex, const float * m, size_t column)
+{
+    __m128 result = _mm_add_ps(_mm_mul_ps(vertex[0], _mm_set1_ps(m[column])), _mm_mul_ps(vertex[1], _mm_set1_ps(m[4 + column])));
+    result = _mm_add_ps(result, _mm_mul_ps(vertex[2], _mm_set1_ps(m[8 + column])));
+    return _mm_add_ps(result, _mm_mul_ps(vertex[3], _mm_set1_ps(m[12 + column])));
+}
+#endif
+
+static unsigned int getoutcode(float x, float y, float z, float w, float guardbandx, float guardbandy)
+{
+    unsigned int outcode = 0U;
+    outcode |= !(x >= -w) ? OUTCODE_LEFT : 0U;
+    outcode |= !(x <= w) ? OUTCODE_RIGHT : 0U;
+    outcode |= !(y >= -w) ? OUTCODE_BOTTOM : 0U;
+    outcode |= !(y <= w) ? OUTCODE_TOP : 0U;
+    outcode |= !(z >= 0.F) ? OUTCODE_NEAR : 0U;
+    outcode |= !(z <= w) ? OUTCODE_FAR : 0U;
+    outcode |= !(w > 0.F) ? OUTCODE_BEHIND : 0U;
+    outcode |= !(x >= -w * guardbandx && x <= w * guardbandx && y >= -w * guardbandy && y <= w * guardbandy) ? OUTCODE_GUARDBAND : 0U;
+    return outcode;
+}
+
+static void calculatelighting(const transformedvertices * vertices, const uint32_t * corners, const point * viewspacelightsourceposition, const light * material, light * l)
+{
+    const float * x = vertices->viewx;
+    const float * y = vertices->viewy;
+    const float * z = vertices->viewz;
+    uint32_t i1 = corners[0];
+    uint32_t i2 = corners[1];
+    uint32_t i3 = corners[2];
+    vector v1 = {x[i2] - x[i1], y[i2] - y[i1], z[i2] - z[i1]};
+    vector v2 = {x[i3] - x[i1], y[i3] - y[i1], z[i3] - z[i1]};
+    vector normalvector;
+    crossproduct(&normalvector, &v1, &v2);
+    normalize(&normalvector);
+    vector lightvector = {
+        viewspacelightsourceposition->x - (x[i1] + x[i2] + x[i3]) / 3.F,
+        viewspacelightsourceposition->y - (y[i1] + y[i2] + y[i3]) / 3.F,
+        viewspacelightsourceposition->z - (z[i1] + z[i2] + z[i3]) / 3.F
+    };
+    normalize(&lightvector);
+    float lambertiancosine = fmaxf(0.F, dotproduct(&normalvector, &lightvector));
+    l->red = material->red * lambertiancosine;
+    l->green = material->green * lambertiancosine;
+    l->blue = material->blue * lambertiancosine;
+}
+
+static bool assembletriangles(const transformedvertices * vertices, const uint32_t * indices, size_t trianglecount, const point * viewspacelightsourceposition, const light * material, float width, float height, trianglestreams * clippedstreams, uint8_t * outputcounts, assemblychunk * chunks, size_t chunkcount, renderer_stats * stats)
+{
+    if (chunkcount > trianglecount / PIPELINE_MINIMUM_CHUNK + 1) {
+        chunkcount = trianglecount / PIPELINE_MINIMUM_CHUNK + 1;
+    }
+    for (size_t chunkindex = 0; chunkindex < chunkcount; chunkindex += 1) {
+        chunks[chunkindex].vertices = vertices;
+        chunks[chunkindex].indices = indices;
+        chunks[chunkindex].viewspacelightsourceposition = viewspacelightsourceposition;
+        chunks[chunkindex].material = material;
+        chunks[chunkindex].width = width;
+        chunks[chunkindex].height = height;
+        chunks[chunkindex].guardbandx = 1.F + GUARD_BAND_SIZE / width;
+        chunks[chunkindex].guardbandy = 1.F + GUARD_BAND_SIZE / height;
+        chunks[chunkindex].outputcounts = outputcounts;
+        chunks[chunkindex].streams = clippedstreams;
+        chunks[chunkindex].first = trianglecount * chunkindex / chunkcount;
+        chunks[chunkindex].last = trianglecount * (chunkindex + 1) / chunkcount;
+    }
+    double start = getmilliseconds();
+    tracezone zone;
+    begintracezone(&zone, "clip");
+    runinparallel(countassembledtriangles, chunks, sizeof(assemblychunk), chunkcount);
+
+    /* The streams are sized once for the exact output, each chunk writes after the chunks before it */
+    size_t offset = 0;
+    for (size_t chunkindex = 0; chunkindex < chunkcount; chunkindex += 1) {
+        chunks[chunkindex].offset = offset;
+        offset += chunks[chunkindex].count;
+        stats->trianglesculled += chunks[chunkindex].rejectedcount;
+        stats->trianglesclipped += chunks[chunkindex].clippedcount;
+        stats->trianglessplit += chunks[chunkindex].splitcount;
+    }
+    clippedstreams->size = 0;
+    if (!reservetrianglestreams(clippedstreams, offset)) {
+        return false;
+    }
+    clippedstreams->size = offset;
+    stats->cliptime = getmilliseconds() - start;
+    endtracezone(&zone);
+
+    /* The write pass clips again, but most of its time goes to lighting */
+    start = getmilliseconds();
+    begintracezone(&zone, "light");
+    runinparallel(writeassembledtriangles, chunks, sizeof(assemblychunk), chunkcount);
+    stats->lighttime = getmilliseconds() - start;
+    endtracezone(&zone);
+    return true;
+}
+
+static void countassembledtriangles(void * argument)
+{
+    assemblychunk * chunk = argument;
+    chunk->count = 0;
+    chunk->rejectedcount = 0;
+    chunk->clippedcount = 0;
+    chunk->splitcount = 0;
+    for (size_t triangleindex = chunk->first; triangleindex < chunk->last; triangleindex += 1) {
+        polygon clipped;
+        bool clipping;
+        size_t outputcount = assembletriangle(chunk, &chunk->indices[triangleindex * 3], &clipped, &clipping);
+        chunk->outputcounts[triangleindex] = (uint8_t)outputcount;
+        chunk->count += outputcount;
+        if (outputcount == 0) {
+            chunk->rejectedcount += 1;
+        } else if (clipping) {
+            chunk->clippedcount += 1;
+            chunk->splitcount += outputcount - 1;
+        }
+    }
+}
+
+static void writeassembledtriangles(void * argument)
+{
+    /* Triangles are clipped again rather than kept from the count pass, only the few crossing a clip plane cost more than a copy */
+    assemblychunk * chunk = argument;
+    size_t offset = chunk->offset;
+    for (size_t triangleindex = chunk->first; triangleindex < chunk->last; triangleindex += 1) {
+        if (chunk->outputcounts[triangleindex] == 0) {
+            continue;
+        }
+        const uint32_t * corners = &chunk->indices[triangleindex * 3];
+        polygon clipped;
+        bool clipping;
+        size_t outputcount = assembletriangle(chunk, corners, &clipped, &clipping);
+        light l;
+        calculatelighting(chunk->vertices, corners, chunk->viewspacelightsourceposition, chunk->material, &l);
+        for (size_t newtriangleindex = 0; newtriangleindex < outputcount; newtriangleindex += 1) {
+            storetriangle(chunk->streams, offset, &clipped.vertices[0], &clipped.vertices[newtriangleindex + 1], &clipped.vertices[newtriangleindex + 2], &l);
+            offset += 1;
+        }
+    }
+}
+
+static size_t assembletriangle(const assemblychunk * chunk, const uint32_t * corners, polygon * clipped, bool * clipping)
+{
+    /* Returns the number of triangles in the fan over the clipped polygon, whose vertices are in screen space, and whether it went through clipping */
+    const transformedvertices * vertices = chunk->vertices;
+    uint32_t i1 = corners[0];
+    uint32_t i2 = corners[1];
+    uint32_t i3 = corners[2];
+    unsigned int outcode1 = vertices->outcodes[i1];
+    unsigned int outcode2 = vertices->outcodes[i2];
+    unsigned int outcode3 = vertices->outcodes[i3];
+
+    /* Triangles outside one clip plane are rejected, which holds in clip space even for vertices behind the eye */
+    unsigned int clipcodes = outcode1 | outcode2 | outcode3;
+    *clipping = false;
+    if ((outcode1 & outcode2 & outcode3 & ~OUTCODE_GUARDBAND) != 0U) {
+        return 0;
+    }
+
+    /* Inside the guard band the rasterizer scissors to the viewport, only near and far need clipping */
+    if ((clipcodes & (OUTCODE_NEAR | OUTCODE_FAR | OUTCODE_BEHIND | OUTCODE_GUARDBAND)) == 0U) {
+        clipped->size = 3;
+        for (size_t corner = 0; corner < 3; corner += 1) {
+            clipped->vertices[corner].x = vertices->screenx[corners[corner]];
+            clipped->vertices[corner].y = vertices->screeny[corners[corner]];
+            clipped->vertices[corner].z = vertices->ndcz[corners[corner]];
+        }
+        return 1;
+    }
+    *clipping = true;
+    polygon polygons[2];
+    if ((clipcodes & (OUTCODE_NEAR | OUTCODE_BEHIND)) != 0U) {
+        if (!clipnearplane(vertices, corners, chunk->guardbandx, chunk->guardbandy, &polygons[0], &clipcodes)) {
+            return 0;
+        }
+    } else {
+        polygons[0].size = 3;
+        for (size_t corner = 0; corner < 3; corner += 1) {
+            uint32_t vertexindex = corners[corner];
+            polygons[0].vertices[corner].x = vertices->clipx[vertexindex] / vertices->clipw[vertexindex];
+            polygons[0].vertices[corner].y = vertices->clipy[vertexindex] / vertices->clipw[vertexindex];
+            polygons[0].vertices[corner].z = vertices->ndcz[vertexindex];
+        }
+    }
+    if ((clipcodes & OUTCODE_GUARDBAND) == 0U) {
+        clipcodes &= OUTCODE_NEAR | OUTCODE_FAR;
+    }
+
+    /* Sutherland-Hodgman in normalized device coordinates against the planes the vertices lie outside of, x >= -1, x <= 1, y >= -1, y <= 1, z >= 0 and z <= 1 */
+    size_t current = 0;
+    for (size_t plane = 0; plane < 6 && polygons[current].size >= 3; plane += 1) {
+        if ((clipcodes & 1U << plane) != 0U) {
+            clippolygon(&polygons[current], &polygons[current ^ 1U], plane / 2, plane < 4 ? (plane % 2 == 0 ? -1.F : 1.F) : (float)(plane % 2), plane % 2 == 0);
+            current ^= 1U;
+        }
+    }
+    if (polygons[current].size < 3) {
+        return 0;
+    }
+
+    /* Viewport transformation */
+    *clipped = polygons[current];
+    for (size_t vertexindex = 0; vertexindex < clipped->size; vertexindex += 1) {
+        clipped->vertices[vertexindex].x = clipped->vertices[vertexindex].x * chunk->width + chunk->width;
+        clipped->vertices[vertexindex].y = clipped->vertices[vertexindex].y * -chunk->height + chunk->height;
+    }
+    return clipped->size - 2;
+}
+
+static bool clipnearplane(const transformedvertices * vertices, const uint32_t * corners, float guardbandx, float guardbandy, polygon * clipped, unsigned int * clipcodes)
+{
+    /* Sutherland-Hodgman against z >= 0 in clip space, before the divide, cuts away the part of the triangle behind the eye */
+    float homogeneous[4][4];
+    size_t count = 0;
+    for (size_t corner = 0; corner < 3; corner += 1) {
+        uint32_t current = corners[corner];
+        uint32_t next = corners[(corner + 1) % 3];
+        float currentvertex[4] = {vertices->clipx[current], vertices->clipy[current], vertices->clipz[current], vertices->clipw[current]};
+        float nextvertex[4] = {vertices->clipx[next], vertices->clipy[next], vertices->clipz[next], vertices->clipw[next]};
+        bool inside = currentvertex[2] >= 0.F;
+        if (inside) {
+            memcpy(homogeneous[count], currentvertex, sizeof currentvertex);
+            count += 1;
+        }
+        if (inside != (nextvertex[2] >= 0.F)) {
+            /* Append intersection point */
+            float ratio = currentvertex[2] / (currentvertex[2] - nextvertex[2]);
+            for (size_t component = 0; component < 4; component += 1) {
+                homogeneous[count][component] = currentvertex[component] + (nextvertex[component] - currentvertex[component]) * ratio;
+            }
+            homogeneous[count][2] = 0.F;
+            count += 1;
+        }
+    }
+
+    /* Points on the near plane have w equal to zNear, only degenerate homogeneous input can still fail the divide */
+    clipped->size = count;
+    *clipcodes = 0U;
+    for (size_t vertexindex = 0; vertexindex < count; vertexindex += 1) {
+        const float * vertex = homogeneous[vertexindex];
+        if (!(vertex[3] > 0.F)) {
+            return false;
+        }
+        clipped->vertices[vertexindex].x = vertex[0] / vertex[3];
+        clipped->vertices[vertexindex].y = vertex[1] / vertex[3];
+        clipped->vertices[vertexindex].z = vertex[2] / vertex[3];
+        *clipcodes |= getoutcode(vertex[0], vertex[1], vertex[2], vertex[3], guardbandx, guardbandy);
+    }
+    return count >= 3;
+}
+
+static void clippolygon(const polygon * input, polygon * output, size_t axis, float boundary, bool keepgreater)
+{
+    /* One Sutherland-Hodgman pass, the polygon keeps its first vertex first when that one is inside */
+    output->size = 0;
+    point previous = input->vertices[0];
+    float previouscomponent = *getpointcomponent(&previous, axis);
+    bool inside = keepgreater ? previouscomponent >= boundary : previouscomponent <= boundary;
+    if (inside) {
+        output->vertices[output->size] = previous;
+        output->size += 1;
+    }
+    for (size_t vertexindex = 1; vertexindex <= input->size; vertexindex += 1) {
+        point next = input->vertices[vertexindex % input->size];
+        float nextcomponent = *getpointcomponent(&next, axis);
+        bool nextinside = keepgreater ? nextcomponent >= boundary : nextcomponent <= boundary;
+        if (inside != nextinside) {
+            /* Append intersection point */
+            float ratio = (boundary - previouscomponent) / (nextcomponent - previouscomponent);
+            point * intersection = &output->vertices[output->size];
+            intersection->x = previous.x + (next.x - previous.x) * ratio;
+            intersection->y = previous.y + (next.y - previous.y) * ratio;
+            intersection->z = previous.z + (next.z - previous.z) * ratio;
+            *getpointcomponent(intersection, axis) = boundary;
+            output->size += 1;
+        }
+        if (nextinside && vertexindex < input->size) {
+            output->vertices[output->size] = next;
+            output->size += 1;
+        }
+        inside = nextinside;
+        previous = next;
+        previouscomponent = nextcomponent;
+    }
+}
+
+static float * getpointcomponent(point * p, size_t axis)
+{
+    return axis == 0 ? &p->x : axis == 1 ? &p->y : &p->z;
+}
+
+static void sortfronttoback(const trianglestreams * streams, uint16_t * keys, size_t * bucketoffsets, size_t * order)
+{
+    /* Counting sort on the nearest vertex depth quantized over the depth range, triangles in one bucket keep their order */
+    float nearest = FLT_MAX;
+    float farthest = -FLT_MAX;
+    for (size_t triangleindex = 0; triangleindex < streams->size; triangleindex += 1) {
+        const float * z = &streams->z[triangleindex * 3];
+        float depth = fminf(z[0], fminf(z[1], z[2]));
+        nearest = fminf(nearest, depth);
+        farthest = fmaxf(farthest, depth);
+    }
+    float scale = farthest > nearest ? (float)(DEPTH_SORT_BUCKETS - 1) / (farthest - nearest) : 0.F;
+    memset(bucketoffsets, 0, (DEPTH_SORT_BUCKETS + 1) * sizeof(size_t));
+    for (size_t triangleindex = 0; triangleindex < streams->size; triangleindex += 1) {
+        const float * z = &streams->z[triangleindex * 3];
+        float bucket = (fminf(z[0], fminf(z[1], z[2])) - nearest) * scale;
+        keys[triangleindex] = bucket > 0.F ? (uint16_t)fminf(bucket, (float)(DEPTH_SORT_BUCKETS - 1)) : 0U;
+        bucketoffsets[keys[triangleindex] + 1] += 1;
+    }
+    for (size_t bucket = 0; bucket < DEPTH_SORT_BUCKETS; bucket += 1) {
+        bucketoffsets[bucket + 1] += bucketoffsets[bucket];
+    }
+    for (size_t triangleindex = 0; triangleindex < streams->size; triangleindex += 1) {
+        order[bucketoffsets[keys[triangleindex]]] = triangleindex;
+        bucketoffsets[keys[triangleindex]] += 1;
+    }
+}
+
+static size_t * radixsort(uint32_t * keys, size_t * indices, uint32_t * sortedkeys, size_t * sortedindices, size_t count, radixsortchunk * chunks, size_t chunkcount)
+{
+    /* Stable LSD radix sort, the result does not depend on the number of chunks */
+    for (unsigned int shift = 0U; shift < 32U; shift += RADIX_SORT_BITS) {
+        for (size_t chunkindex = 0; chunkindex < chunkcount; chunkindex += 1) {
+            chunks[chunkindex].keys = keys;
+            chunks[chunkindex].indices = indices;
+            chunks[chunkindex].sortedkeys = sortedkeys;
+            chunks[chunkindex].sortedindices = sortedindices;
+            chunks[chunkindex].first = count * chunkindex / chunkcount;
+            chunks[chunkindex].last = count * (chunkindex + 1) / chunkcount;
+            chunks[chunkindex].shift = shift;
+        }
+        runinparallel(countradixdigits, chunks, sizeof(radixsortchunk), chunkcount);
+
+        /* Each chunk writes a digit after the same digit of the chunks before it, a pass with a single digit changes nothing */
+        size_t offset = 0;
+        bool skipped = false;
+        for (size_t digit = 0; digit < RADIX_SORT_BUCKETS; digit += 1) {
+            size_t digitcount = 0;
+            for (size_t chunkindex = 0; chunkindex < chunkcount; chunkindex += 1) {
+                size_t chunkdigitcount = chunks[chunkindex].offsets[digit];
+                chunks[chunkindex].offsets[digit] = offset;
+                offset += chunkdigitcount;
+                digitcount += chunkdigitcount;
+            }
+            if (digitcount == count) {
+                skipped = true;
+            }
+        }
+        if (skipped) {
+            continue;
+        }
+        runinparallel(scatterradixdigits, chunks, sizeof(radixsortchunk), chunkcount);
+
+        uint32_t * tempkeys = keys;
+        keys = sortedkeys;
+        sortedkeys = tempkeys;
+        size_t * tempindices = indices;
+        indices = sortedindices;
+        sortedindices = tempindices;
+    }
+    return indices;
+}
+
+static void countradixdigits(void * argument)
+{
+    radixsortchunk * chunk = argument;
+    memset(chunk->offsets, 0, sizeof chunk->offsets);
+    for (size_t index = chunk->first; index < chunk->last; index += 1) {
+        chunk->offsets[chunk->keys[index] >> chunk->shift & (RADIX_SORT_BUCKETS - 1)] += 1;
+    }
+}
+
+static void scatterradixdigits(void * argument)
+{
+    radixsortchunk * chunk = argument;
+    for (size_t index = chunk->first; index < chunk->last; index += 1) {
+        size_t destination = chunk->offsets[chunk->keys[index] >> chunk->shift & (RADIX_SORT_BUCKETS - 1)]++;
+        chunk->sortedkeys[destination] = chunk->keys[index];
+        chunk->sortedindices[destination] = chunk->indices[index];
+    }
+}
+
+static uint32_t floattosortablekey(float value)
+{
+    /* Flips the sign bit of positive values and every bit of negative ones, so the keys compare like the floats */
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof bits);
+    return bits & 0x80000000U ? ~bits : bits | 0x80000000U;
+}
+
+static bool gettrianglebounds(const trianglestreams * streams, size_t triangleindex, int samplewidth, int sampleheight, int * minx, int * maxx, int * miny, int * maxy)
+{
+    const float * x = &streams->x[triangleindex * 3];
+    const float * y = &streams->y[triangleindex * 3];
+    *minx = (int)roundf(fminf(x[0], fminf(x[1], x[2])));
+    *maxx = (int)roundf(fmaxf(x[0], fmaxf(x[1], x[2])));
+    *miny = (int)roundf(fminf(y[0], fminf(y[1], y[2])));
+    *maxy = (int)roundf(fmaxf(y[0], fmaxf(y[1], y[2])));
+    if (*minx < 0) {
+        *minx = 0;
+    }
+    if (*maxx > samplewidth - 1) {
+        *maxx = samplewidth - 1;
+    }
+    if (*miny < 0) {
+        *miny = 0;
+    }
+    if (*maxy > sampleheight - 1) {
+        *maxy = sampleheight - 1;
+    }
+    return *minx <= *maxx && *miny <= *maxy;
+}
+
+static void rasterizationworker(void * argument)
+{
+    rasterjob * job = argument;
+    double rastertime = 0.0;
+    double resolvetime = 0.0;
+    uint64_t samplestested = 0;
+    uint64_t sampleswritten = 0;
+    for (;;) {
+        lockmutex(&job->mutex);
+        size_t tileindex = job->nexttile;
+        job->nexttile += 1;
+        unlockmutex(&job->mutex);
+        if (tileindex >= job->tilecolumns * job->tilerows) {
+            break;
+        }
+        double start = getmilliseconds();
+        tracezone zone;
+        begintracezone(&zone, "rasterize tile");
+        rasterizetile(job, tileindex, &samplestested, &sampleswritten);
+        endtracezone(&zone);
+        double end = getmilliseconds();
+        rastertime += end - start;
+        if (job->samplegrid > 1) {
+            begintracezone(&zone, "resolve tile");
+            resolvetile(job, tileindex);
+            endtracezone(&zone);
+            resolvetime += getmilliseconds() - end;
+        }
+    }
+
+    /* Totals of this worker go to the job once, not per tile */
+    lockmutex(&job->mutex);
+    job->rastertime += rastertime;
+    job->resolvetime += resolvetime;
+    job->samplestested += samplestested;
+    job->sampleswritten += sampleswritten;
+    unlockmutex(&job->mutex);
+}
+
+static void rasterizetile(const rasterjob * job, size_t tileindex, uint64_t * samplestested, uint64_t * sampleswritten)
+{
+    uint32_t * samplesurface = job->samplesurface;
+    float * zbuffer = job->zbuffer;
+    size_t rowlength = (size_t)job->samplewidth;
+    int tileminx = (int)(tileindex % job->tilecolumns) * job->tilesize;
+    int tileminy = (int)(tileindex / job->tilecolumns) * job->tilesize;
+    int tilemaxx = tileminx + job->tilesize - 1;
+    int tilemaxy = tileminy + job->tilesize - 1;
+
+    /* The buffers are reused between frames, clear this tile before drawing into it */
+    size_t clearwidth = (size_t)(tilemaxx < job->samplewidth ? tilemaxx + 1 : job->samplewidth) - (size_t)tileminx;
+    int clearmaxy = tilemaxy < job->sampleheight ? tilemaxy : job->sampleheight - 1;
+    for (int y = tileminy; y <= clearmaxy; y += 1) {
+        size_t index = (size_t)y * rowlength + (size_t)tileminx;
+        memset(&samplesurface[index], 0, clearwidth * sizeof(uint32_t));
+        if (zbuffer != NULL) {
+            for (size_t x = 0; x < clearwidth; x += 1) {
+                zbuffer[index + x] = FLT_MAX;
+            }
+        }
+    }
+
+    /* Hierarchical Z, a conservative maximum of the depths stored in each block of this tile */
+    float hierarchicalz[HIERARCHICAL_Z_COLUMNS * HIERARCHICAL_Z_COLUMNS];
+    int hierarchicalzminx = tileminx / RASTER_BLOCK_SIZE;
+    int hierarchicalzminy = tileminy / RASTER_BLOCK_SIZE;
+    for (size_t cellindex = 0; cellindex < HIERARCHICAL_Z_COLUMNS * HIERARCHICAL_Z_COLUMNS; cellindex += 1) {
+        hierarchicalz[cellindex] = FLT_MAX;
+    }
+
+    for (size_t binindex = job->binoffsets[tileindex]; binindex < job->binoffsets[tileindex + 1]; binindex += 1) {
+        size_t triangleindex = job->binentries[binindex];
+        rastertriangle rt;
+        if (!setuprastertriangle(job->streams, triangleindex, &rt)) {
+            continue;
+        }
+        int minx;
+        int maxx;
+        int miny;
+        int maxy;
+        gettrianglebounds(job->streams, triangleindex, job->samplewidth, job->sampleheight, &minx, &maxx, &miny, &maxy);
+        minx = minx < tileminx ? tileminx : minx;
+        maxx = maxx > tilemaxx ? tilemaxx : maxx;
+        miny = miny < tileminy ? tileminy : miny;
+        maxy = maxy > tilemaxy ? tilemaxy : maxy;
+
+        /* Depths from the plane equation may differ from the per-sample ones by rounding, block bounds are widened by this much */
+        float deptherror = (fabsf(rt.normal.x) * (float)maxx + fabsf(rt.normal.y) * (float)maxy + fabsf(rt.d)) * 8.F * FLT_EPSILON / fabsf(rt.normal.z);
+
+        /* The SIMD kernels step 32-bit edge values, up to a full block past the last column */
+        bool usekernel = job->spankernel != NULL;
+        for (size_t edgeindex = 0; edgeindex < 3 && usekernel; edgeindex += 1) {
+            int64_t cornerx[2] = {minx, maxx + RASTER_BLOCK_SIZE};
+            int64_t cornery[2] = {miny, maxy};
+            for (size_t cornerindex = 0; cornerindex < 4; cornerindex += 1) {
+                int64_t value = rt.edgeconstant[edgeindex] + rt.edgex[edgeindex] * cornerx[cornerindex & 1] + rt.edgey[edgeindex] * cornery[cornerindex >> 1];
+                if (value < INT32_MIN || value > INT32_MAX) {
+                    usekernel = false;
+                }
+            }
+        }
+
+        /* Walk the bounding box in blocks, rows in memory order */
+        for (int blockminy = miny; blockminy <= maxy; blockminy = (blockminy & ~(RASTER_BLOCK_SIZE - 1)) + RASTER_BLOCK_SIZE) {
+            int blockmaxy = (blockminy | (RASTER_BLOCK_SIZE - 1)) < maxy ? blockminy | (RASTER_BLOCK_SIZE - 1) : maxy;
+            for (int blockminx = minx; blockminx <= maxx; blockminx = (blockminx & ~(RASTER_BLOCK_SIZE - 1)) + RASTER_BLOCK_SIZE) {
+                int blockmaxx = (blockminx | (RASTER_BLOCK_SIZE - 1)) < maxx ? blockminx | (RASTER_BLOCK_SIZE - 1) : maxx;
+
+                /* Reject the block if it lies outside any edge, skip the coverage test if it lies inside all of them */
+                bool outside = false;
+                bool inside = true;
+                for (size_t edgeindex = 0; edgeindex < 3; edgeindex += 1) {
+                    int64_t maximum = rt.edgeconstant[edgeindex] + rt.edgex[edgeindex] * (rt.edgex[edgeindex] > 0 ? blockmaxx : blockminx) + rt.edgey[edgeindex] * (rt.edgey[edgeindex] > 0 ? blockmaxy : blockminy);
+                    int64_t minimum = rt.edgeconstant[edgeindex] + rt.edgex[edgeindex] * (rt.edgex[edgeindex] > 0 ? blockminx : blockmaxx) + rt.edgey[edgeindex] * (rt.edgey[edgeindex] > 0 ? blockminy : blockmaxy);
+                    if (maximum < 0) {
+                        outside = true;
+                    }
+                    if (minimum < 0) {
+                        inside = false;
+                    }
+                }
+                if (outside) {
+                    continue;
+                }
+
+                /* Skip the block if the triangle lies behind everything drawn there */
+                float * cell = NULL;
+                float blockmaximumdepth = FLT_MAX;
+                if (zbuffer != NULL) {
+                    float blockminimumdepth;
+                    getblockdepthrange(&rt, blockminx, blockmaxx, blockminy, blockmaxy, &blockminimumdepth, &blockmaximumdepth);
+                    cell = &hierarchicalz[(blockminy / RASTER_BLOCK_SIZE - hierarchicalzminy) * HIERARCHICAL_Z_COLUMNS + blockminx / RASTER_BLOCK_SIZE - hierarchicalzminx];
+                    if (blockminimumdepth - deptherror >= *cell) {
+                        continue;
+                    }
+                }
+
+                int64_t rowe0 = rt.edgeconstant[0] + rt.edgex[0] * blockminx + rt.edgey[0] * blockminy;
+                int64_t rowe1 = rt.edgeconstant[1] + rt.edgex[1] * blockminx + rt.edgey[1] * blockminy;
+                int64_t rowe2 = rt.edgeconstant[2] + rt.edgex[2] * blockminx + rt.edgey[2] * blockminy;
+                for (int y = blockminy; y <= blockmaxy; y += 1) {
+                    size_t index = (size_t)y * rowlength + (size_t)blockminx;
+                    int written;
+                    if (usekernel) {
+                        written = job->spankernel(&rt, (int32_t)rowe0, (int32_t)rowe1, (int32_t)rowe2, blockminx, y, blockmaxx - blockminx + 1, &samplesurface[index], zbuffer != NULL ? &zbuffer[index] : NULL);
+                    } else {
+                        written = rasterizespan(&rt, rowe0, rowe1, rowe2, blockminx, y, blockmaxx - blockminx + 1, inside, &samplesurface[index], zbuffer != NULL ? &zbuffer[index] : NULL);
+                    }
+                    *samplestested += (uint64_t)(blockmaxx - blockminx + 1);
+                    *sampleswritten += (uint64_t)written;
+                    rowe0 += rt.edgey[0];
+                    rowe1 += rt.edgey[1];
+                    rowe2 += rt.edgey[2];
+                }
+
+                /* A triangle covering all samples of the block leaves no depth there above its own maximum */
+                if (cell != NULL && inside && blockmaximumdepth + deptherror < *cell) {
+                    int cellminx = (blockminx & ~(RASTER_BLOCK_SIZE - 1)) > tileminx ? blockminx & ~(RASTER_BLOCK_SIZE - 1) : tileminx;
+                    int cellminy = (blockminy & ~(RASTER_BLOCK_SIZE - 1)) > tileminy ? blockminy & ~(RASTER_BLOCK_SIZE - 1) : tileminy;
+                    int cellmaxx = (blockminx | (RASTER_BLOCK_SIZE - 1)) < tilemaxx ? blockminx | (RASTER_BLOCK_SIZE - 1) : tilemaxx;
+                    int cellmaxy = (blockminy | (RASTER_BLOCK_SIZE - 1)) < tilemaxy ? blockminy | (RASTER_BLOCK_SIZE - 1) : tilemaxy;
+                    cellmaxx = cellmaxx < job->samplewidth - 1 ? cellmaxx : job->samplewidth - 1;
+                    cellmaxy = cellmaxy < job->sampleheight - 1 ? cellmaxy : job->sampleheight - 1;
+                    if (blockminx == cellminx && blockmaxx == cellmaxx && blockminy == cellminy && blockmaxy == cellmaxy) {
+                        *cell = blockmaximumdepth + deptherror;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static bool setuprastertriangle(const trianglestreams * streams, size_t triangleindex, rastertriangle * rt)
+{
+    const float * x = &streams->x[triangleindex * 3];
+    const float * y = &streams->y[triangleindex * 3];
+    const float * z = &streams->z[triangleindex * 3];
+    const light * l = &streams->lighting[triangleindex];
+    int64_t x1 = (int64_t)roundf(x[0]);
+    int64_t y1 = (int64_t)roundf(y[0]);
+    int64_t x2 = (int64_t)roundf(x[1]);
+    int64_t y2 = (int64_t)roundf(y[1]);
+    int64_t x3 = (int64_t)roundf(x[2]);
+    int64_t y3 = (int64_t)roundf(y[2]);
+    int64_t area = (x2 - x1) * (y3 - y1) - (y2 - y1) * (x3 - x1);
+    if (area == 0) {
+        return false;
+    }
+    if (area < 0) {
+        int64_t temp = x2;
+        x2 = x3;
+        x3 = temp;
+        temp = y2;
+        y2 = y3;
+        y3 = temp;
+    }
+    setupedge(rt, 0, x1, y1, x2, y2);
+    setupedge(rt, 1, x2, y2, x3, y3);
+    setupedge(rt, 2, x3, y3, x1, y1);
+
+    vector v1 = {x[1] - x[0], y[1] - y[0], z[1] - z[0]};
+    vector v2 = {x[2] - x[0], y[2] - y[0], z[2] - z[0]};
+    vector p1 = {x[0], y[0], z[0]};
+    crossproduct(&rt->normal, &v1, &v2);
+    rt->d = dotproduct(&rt->normal, &p1);
+    rt->color = 0xFF000000 | (uint32_t)roundf(l->blue * 255.F) << 16 | (uint32_t)roundf(l->green * 255.F) << 8 | (uint32_t)roundf(l->red * 255.F);
+    return true;
+}
+
+static void setupedge(rastertriangle * rt, size_t edgeindex, int64_t startx, int64_t starty, int64_t endx, int64_t endy)
+{
+    /* E(x, y) = edgex * x + edgey * y + edgeconstant is non-negative on the inner side of the edge */
+    rt->edgex[edgeindex] = starty - endy;
+    rt->edgey[edgeindex] = endx - startx;
+    rt->edgeconstant[edgeindex] = startx * endy - starty * endx;
+
+    /* Top-left fill rule: samples exactly on a bottom or right edge belong to the neighbouring triangle */
+    bool topedge = starty == endy && endx > startx;
+    bool leftedge = endy < starty;
+    if (!topedge && !leftedge) {
+        rt->edgeconstant[edgeindex] -= 1;
+    }
+}
+
+static void getblockdepthrange(const rastertriangle * rt, int minx, int maxx, int miny, int maxy, float * minimum, float * maximum)
+{
+    /* Depth is linear in screen space, so its extremes over a block lie at the corners */
+    float corners[4] = {
+        -(rt->normal.x * minx + rt->normal.y * miny - rt->d) / rt->normal.z,
+        -(rt->normal.x * maxx + rt->normal.y * miny - rt->d) / rt->normal.z,
+        -(rt->normal.x * minx + rt->normal.y * maxy - rt->d) / rt->normal.z,
+        -(rt->normal.x * maxx + rt->normal.y * maxy - rt->d) / rt->normal.z
+    };
+    *minimum = fminf(fminf(corners[0], corners[1]), fminf(corners[2], corners[3]));
+    *maximum = fmaxf(fmaxf(corners[0], corners[1]), fmaxf(corners[2], corners[3]));
+}
+
+static int rasterizespan(const rastertriangle * rt, int64_t e0, int64_t e1, int64_t e2, int x, int y, int count, bool inside, uint32_t * colors, float * depths)
+{
+    int written = 0;
+    for (int lane = 0; lane < count; lane += 1) {
+        if (inside || (e0 | e1 | e2) >= 0) {
+            if (depths != NULL) {
+                float z = -(rt->normal.x * (x + lane) + rt->normal.y * y - rt->d) / rt->normal.z;
+                if (z < depths[lane]) {
+                    colors[lane] = rt->color;
+                    depths[lane] = z;
+                    written += 1;
+                }
+            } else {
+                colors[lane] = rt->color;
+                written += 1;
+            }
+        }
+        e0 += rt->edgex[0];
+        e1 += rt->edgex[1];
+        e2 += rt->edgex[2];
+    }
+    return written;
+}
+
+static rasterspankernel selectspankernel(void)
+{
+#if defined(RENDERER_SIMD_X86)
+#if defined(_MSC_VER)
+    int cpuinfo[4];
+    __cpuid(cpuinfo, 0);
+    if (cpuinfo[0] >= 7) {
+        __cpuid(cpuinfo, 1);
+        bool osxsave = (cpuinfo[2] & (1 << 27)) != 0;
+        bool avx = (cpuinfo[2] & (1 << 28)) != 0;
+        __cpuidex(cpuinfo, 7, 0);
+        if (osxsave && avx && (cpuinfo[1] & (1 << 5)) != 0 && (_xgetbv(0) & 6) == 6) {
+            return rasterizespanavx2;
+        }
+    }
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return rasterizespanavx2;
+    }
+#endif
+    return rasterizespansse2;
+#else
+    return NULL;
+#endif
+}
+
+#if defined(RENDERER_SIMD_X86)
+static int rasterizespansse2(const rastertriangle * rt, int32_t e0, int32_t e1, int32_t e2, int x, int y, int count, uint32_t * colors, float * depths)
+{
+    /* Four samples per step with full-width loads and stores, the remainder is done by the scalar path */
+    int32_t edgex0 = (int32_t)rt->edgex[0];
+    int32_t edgex1 = (int32_t)rt->edgex[1];
+    int32_t edgex2 = (int32_t)rt->edgex[2];
+    __m128i edge0 = _mm_setr_epi32(e0, e0 + edgex0, e0 + edgex0 * 2, e0 + edgex0 * 3);
+    __m128i edge1 = _mm_setr_epi32(e1, e1 + edgex1, e1 + edgex1 * 2, e1 + edgex1 * 3);
+    __m128i edge2 = _mm_setr_epi32(e2, e2 + edgex2, e2 + edgex2 * 2, e2 + edgex2 * 3);
+    __m128i step0 = _mm_set1_epi32(edgex0 * 4);
+    __m128i step1 = _mm_set1_epi32(edgex1 * 4);
+    __m128i step2 = _mm_set1_epi32(edgex2 * 4);
+    __m128i color = _mm_set1_epi32((int)rt->color);
+    __m128 xs = _mm_setr_ps((float)x, (float)(x + 1), (float)(x + 2), (float)(x + 3));
+    __m128 normalx = _mm_set1_ps(rt->normal.x);
+    __m128 normaly = _mm_set1_ps(rt->normal.y * y);
+    __m128 d = _mm_set1_ps(rt->d);
+    __m128 normalz = _mm_set1_ps(rt->normal.z);
+    __m128 signmask = _mm_set1_ps(-0.F);
+    int written = 0;
+    int lane = 0;
+    for (; lane + 4 <= count; lane += 4) {
+        __m128i covered = _mm_cmpgt_epi32(_mm_or_si128(_mm_or_si128(edge0, edge1), edge2), _mm_set1_epi32(-1));
+        if (_mm_movemask_epi8(covered) != 0) {
+            if (depths != NULL) {
+                __m128 z = _mm_div_ps(_mm_xor_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(normalx, xs), normaly), d), signmask), normalz);
+                __m128 stored = _mm_loadu_ps(&depths[lane]);
+                __m128 passed = _mm_and_ps(_mm_castsi128_ps(covered), _mm_cmplt_ps(z, stored));
+                _mm_storeu_ps(&depths[lane], _mm_or_ps(_mm_and_ps(passed, z), _mm_andnot_ps(passed, stored)));
+                covered = _mm_castps_si128(passed);
+            }
+            __m128i storedcolors = _mm_loadu_si128((const __m128i *)&colors[lane]);
+            _mm_storeu_si128((__m128i *)&colors[lane], _mm_or_si128(_mm_and_si128(covered, color), _mm_andnot_si128(covered, storedcolors)));
+            written += countmaskbits((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(covered)));
+        }
+        edge0 = _mm_add_epi32(edge0, step0);
+        edge1 = _mm_add_epi32(edge1, step1);
+        edge2 = _mm_add_epi32(edge2, step2);
+        xs = _mm_add_ps(xs, _mm_set1_ps(4.F));
+    }
+    if (lane < count) {
+        written += rasterizespan(rt, (int64_t)e0 + (int64_t)edgex0 * lane, (int64_t)e1 + (int64_t)edgex1 * lane, (int64_t)e2 + (int64_t)edgex2 * lane, x + lane, y, count - lane, false, &colors[lane], depths != NULL ? &depths[lane] : NULL);
+    }
+    return written;
+}
+
+RENDERER_TARGET_AVX2 static int rasterizespanavx2(const rastertriangle * rt, int32_t e0, int32_t e1, int32_t e2, int x, int y, int count, uint32_t * colors, float * depths)
+{
+    /* One step covers a whole block row, lanes past the end of the span are masked off */
+    __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i edge0 = _mm256_add_epi32(_mm256_set1_epi32(e0), _mm256_mullo_epi32(_mm256_set1_epi32((int32_t)rt->edgex[0]), lanes));
+    __m256i edge1 = _mm256_add_epi32(_mm256_set1_epi32(e1), _mm256_mullo_epi32(_mm256_set1_epi32((int32_t)rt->edgex[1]), lanes));
+    __m256i edge2 = _mm256_add_epi32(_mm256_set1_epi32(e2), _mm256_mullo_epi32(_mm256_set1_epi32((int32_t)rt->edgex[2]), lanes));
+    __m256i covered = _mm256_and_si256(
+        _mm256_cmpgt_epi32(_mm256_or_si256(_mm256_or_si256(edge0, edge1), edge2), _mm256_set1_epi32(-1)),
+        _mm256_cmpgt_epi32(_mm256_set1_epi32(count), lanes)
+    );
+    if (_mm256_testz_si256(covered, covered)) {
+        return 0;
+    }
+    if (depths != NULL) {
+        __m256 xs = _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_set1_epi32(x), lanes));
+        __m256 z = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(rt->normal.x), xs), _mm256_set1_ps(rt->normal.y * y));
+        z = _mm256_xor_ps(_mm256_sub_ps(z, _mm256_set1_ps(rt->d)), _mm256_set1_ps(-0.F));
+        z = _mm256_div_ps(z, _mm256_set1_ps(rt->normal.z));
+        __m256 stored = _mm256_maskload_ps(depths, covered);
+        covered = _mm256_and_si256(covered, _mm256_castps_si256(_mm256_cmp_ps(z, stored, _CMP_LT_OQ)));
+        _mm256_maskstore_ps(depths, covered, z);
+    }
+    _mm256_maskstore_epi32((int *)colors, covered, _mm256_set1_epi32((int)rt->color));
+    return countmaskbits((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(covered)));
+}
+
+static int countmaskbits(unsigned int mask)
+{
+    /* Population count of a lane mask of up to eight bits, without a branch or a POPCNT instruction */
+    mask = mask - (mask >> 1 & 0x55U);
+    mask = (mask & 0x33U) + (mask >> 2 & 0x33U);
+    return (int)((mask + (mask >> 4)) & 0x0FU);
+}
+#endif
+
+static void resolvetile(const rasterjob * job, size_t tileindex)
+{
+    surface * target = job->target;
+    size_t samplegrid = (size_t)job->samplegrid;
+    size_t samplewidth = (size_t)job->samplewidth;
+    size_t tilepixels = (size_t)job->tilesize / samplegrid;
+    size_t tileminx = (tileindex % job->tilecolumns) * tilepixels;
+    size_t tileminy = (tileindex / job->tilecolumns) * tilepixels;
+    size_t tilemaxx = tileminx + tilepixels < (size_t)target->width ? tileminx + tilepixels : (size_t)target->width;
+    size_t tilemaxy = tileminy + tilepixels < (size_t)target->height ? tileminy + tilepixels : (size_t)target->height;
+
+    /* Uncovered samples are zero, so summing every sample gives the sums over the covered ones and their count */
+#if defined(RENDERER_SIMD_X86)
+    __m128i zero = _mm_setzero_si128();
+    float samplecount = (float)(samplegrid * samplegrid);
+#endif
+    for (size_t y = tileminy; y < tilemaxy; y += 1) {
+        for (size_t x = tileminx; x < tilemaxx; x += 1) {
+            const uint32_t * samples = &job->samplesurface[y * samplegrid * samplewidth + x * samplegrid];
+#if defined(RENDERER_SIMD_X86)
+            __m128i sums = zero;
+            for (size_t sampley = 0; sampley < samplegrid; sampley += 1) {
+                for (size_t samplex = 0; samplex < samplegrid; samplex += 1) {
+                    sums = _mm_add_epi16(sums, _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)samples[sampley * samplewidth + samplex]), zero));
+                }
+            }
+            int alphasum = _mm_extract_epi16(sums, 3);
+            if (alphasum == 0) {
+                continue;
+            }
+
+            /* Colors average over the covered samples and alpha over all of them, division is exact before truncation */
+            float covered = (float)(alphasum / 0xFF);
+            __m128 averages = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(sums, zero)), _mm_setr_ps(covered, covered, covered, samplecount));
+            __m128i packed = _mm_cvttps_epi32(averages);
+            packed = _mm_packs_epi32(packed, packed);
+            packed = _mm_packus_epi16(packed, packed);
+            target->pixels[y * target->width + x] = (uint32_t)_mm_cvtsi128_si32(packed);
+#else
+            uint32_t red = 0U;
+            uint32_t green = 0U;
+            uint32_t blue = 0U;
+            uint32_t alpha = 0U;
+            for (size_t sampley = 0; sampley < samplegrid; sampley += 1) {
+                for (size_t samplex = 0; samplex < samplegrid; samplex += 1) {
+                    uint32_t sample = samples[sampley * samplewidth + samplex];
+                    red += sample & 0xFFU;
+                    green += sample >> 8 & 0xFFU;
+                    blue += sample >> 16 & 0xFFU;
+                    alpha += sample >> 24;
+                }
+            }
+            if (alpha == 0U) {
+                continue;
+            }
+            uint32_t covered = alpha / 0xFFU;
+            target->pixels[y * target->width + x] = alpha / (uint32_t)(samplegrid * samplegrid) << 24 | blue / covered << 16 | green / covered << 8 | red / covered;
+#endif
+        }
+    }
+}
+
+static bool writepngserially(const renderer_context * context, const surface * s, FILE * filepointer)
+{
+    png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    if (png == NULL) {
+        return false;
+    }
+    png_infop info = png_create_info_struct(png);
+    if (info == NULL) {
+        png_destroy_write_struct(&png, NULL);
+        return false;
+    }
+
+    static const int filtermasks[] = {PNG_FILTER_NONE, PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_AVG, PNG_FILTER_PAETH, PNG_ALL_FILTERS};
+    png_init_io(png, filepointer);
+    png_set_compression_level(png, context->pngcompressionlevel);
+    png_set_filter(png, PNG_FILTER_TYPE_BASE, filtermasks[context->pngfilter]);
+    png_set_IHDR(png, info, s->width, s->height, 8, PNG_COLOR_TYPE_RGB_ALPHA, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png, info);
+
+    /* Pixels are stored as R, G, B, A bytes already, rows go to libpng without a copy */
+    for (size_t y = 0; y < (size_t)s->height; y += 1) {
+        png_write_row(png, (png_const_bytep)&s->pixels[y * (size_t)s->width]);
+    }
+    png_write_end(png, info);
+    png_destroy_write_struct(&png, &info);
+    return true;
+}
+
+static int writepnginparallel(const renderer_context * context, const surface * s, FILE * filepointer, size_t bandcount)
+{
+    pngband * bands = malloc(bandcount * sizeof(pngband));
+    if (bands == NULL) {
+        return RENDERER_ERROR_INSUFFICIENTMEMORY;
+    }
+    for (size_t bandindex = 0; bandindex < bandcount; bandindex += 1) {
+        bands[bandindex].s = s;
+        bands[bandindex].compressionlevel = context->pngcompressionlevel;
+        bands[bandindex].filter = context->pngfilter;
+        bands[bandindex].firstrow = (size_t)s->height * bandindex / bandcount;
+        bands[bandindex].lastrow = (size_t)s->height * (bandindex + 1) / bandcount;
+        bands[bandindex].last = bandindex + 1 == bandcount;
+        bands[bandindex].data = NULL;
+        bands[bandindex].size = 0;
+        bands[bandindex].capacity = 0;
+        bands[bandindex].failed = false;
+    }
+    runinparallel(compresspngband, bands, sizeof(pngband), bandcount);
+
+    /* The zlib header, the bands and the combined checksum form one stream split over IDAT chunks */
+    int error = RENDERER_ERROR_NONE;
+    uLong adler = bands[0].adler;
+    for (size_t bandindex = 0; bandindex < bandcount; bandindex += 1) {
+        if (bands[bandindex].failed) {
+            error = RENDERER_ERROR_INSUFFICIENTMEMORY;
+        } else if (bandindex != 0) {
+            adler = adler32_combine(adler, bands[bandindex].adler, (z_off_t)((bands[bandindex].lastrow - bands[bandindex].firstrow) * ((size_t)s->width * 4 + 1)));
+        }
+    }
+    if (error == RENDERER_ERROR_NONE) {
+        static const unsigned char signature[8] = {137U, 80U, 78U, 71U, 13U, 10U, 26U, 10U};
+        unsigned char header[13];
+        storebigendian(&header[0], s->width);
+        storebigendian(&header[4], s->height);
+        header[8] = 8U;
+        header[9] = 6U;
+        header[10] = 0U;
+        header[11] = 0U;
+        header[12] = 0U;
+        unsigned char zlibheader[2] = {0x78U, context->pngcompressionlevel < 2 ? 0x00U : context->pngcompressionlevel < 6 ? 0x40U : context->pngcompressionlevel == 6 ? 0x80U : 0xC0U};
+        zlibheader[1] = (unsigned char)(zlibheader[1] + 31U - (zlibheader[0] * 256U + zlibheader[1]) % 31U);
+        unsigned char zlibtrailer[4];
+        storebigendian(zlibtrailer, (uint32_t)adler);
+        bool written = fwrite(signature, sizeof signature, 1, filepointer) == 1 && writepngchunk(filepointer, "IHDR", header, sizeof header) && writepngchunk(filepointer, "IDAT", zlibheader, sizeof zlibheader);
+        for (size_t bandindex = 0; bandindex < bandcount && written; bandindex += 1) {
+            for (size_t offset = 0; offset < bands[bandindex].size && written; offset += PNG_CHUNK_MAXIMUM_SIZE) {
+                size_t size = bands[bandindex].size - offset < PNG_CHUNK_MAXIMUM_SIZE ? bands[bandindex].size - offset : PNG_CHUNK_MAXIMUM_SIZE;
+                written = writepngchunk(filepointer, "IDAT", bands[bandindex].data + offset, size);
+            }
+        }
+        if (!written || !writepngchunk(filepointer, "IDAT", zlibtrailer, sizeof zlibtrailer) || !writepngchunk(filepointer, "IEND", NULL, 0)) {
+            error = RENDERER_ERROR_FILEWRITEFAILED;
+        }
+    }
+    for (size_t bandindex = 0; bandindex < bandcount; bandindex += 1) {
+        free(bands[bandindex].data);
+    }
+    free(bands);
+    return error;
+}
+
+static void compresspngband(void * argument)
+{
+    pngband * band = argument;
+    tracezone zone;
+    begintracezone(&zone, "compress band");
+    size_t rowsize = (size_t)band->s->width * 4 + 1;
+    unsigned char * rows = malloc(rowsize * 5);
+    z_stream stream;
+    stream.zalloc = Z_NULL;
+    stream.zfree = Z_NULL;
+    stream.opaque = Z_NULL;
+    if (rows == NULL || deflateInit2(&stream, band->compressionlevel, Z_DEFLATED, -15, 8, band->filter == RENDERER_PNG_FILTER_NONE ? Z_DEFAULT_STRATEGY : Z_FILTERED) != Z_OK) {
+        free(rows);
+        band->failed = true;
+        return;
+    }
+    band->capacity = deflateBound(&stream, (uLong)((band->lastrow - band->firstrow) * rowsize)) + 64;
+    band->data = malloc(band->capacity);
+    band->adler = adler32(0L, Z_NULL, 0);
+    band->failed = band->data == NULL;
+
+    /* Every band but the last ends on a byte boundary without closing the stream */
+    for (size_t y = band->firstrow; y < band->lastrow && !band->failed; y += 1) {
+        const unsigned char * row = filterpngrow(band->s, y, band->filter, rows);
+        band->adler = adler32(band->adler, row, (uInt)rowsize);
+        band->failed = !deflatepngband(band, &stream, row, rowsize, Z_NO_FLUSH);
+    }
+    if (!band->failed) {
+        band->failed = !deflatepngband(band, &stream, NULL, 0, band->last ? Z_FINISH : Z_SYNC_FLUSH);
+    }
+    deflateEnd(&stream);
+    free(rows);
+    endtracezone(&zone);
+}
+
+static bool deflatepngband(pngband * band, z_stream * stream, const unsigned char * data, size_t size, int flush)
+{
+    stream->next_in = (Bytef *)data;
+    stream->avail_in = (uInt)size;
+    for (;;) {
+        if (band->size == band->capacity) {
+            unsigned char * newdata = realloc(band->data, band->capacity * 2);
+            if (newdata == NULL) {
+                return false;
+            }
+            band->data = newdata;
+            band->capacity *= 2;
+        }
+        size_t available = band->capacity - band->size;
+        stream->next_out = band->data + band->size;
+        stream->avail_out = available > UINT_MAX ? UINT_MAX : (uInt)available;
+        int result = deflate(stream, flush);
+        band->size = (size_t)(stream->next_out - band->data);
+        if (result == Z_STREAM_ERROR) {
+            return false;
+        }
+        if (flush == Z_FINISH ? result == Z_STREAM_END : stream->avail_in == 0 && stream->avail_out != 0) {
+            return true;
+        }
+    }
+}
+
+static const unsigned char * filterpngrow(const surface * s, size_t y, int filter, unsigned char * rows)
+{
+    /* rows has room for one filtered row per filter type, each starting with its type byte */
+    size_t length = (size_t)s->width * 4;
+    const unsigned char * current = (const unsigned char *)&s->pixels[y * (size_t)s->width];
+    const unsigned char * previous = y == 0 ? NULL : current - length;
+    int firsttype = filter == RENDERER_PNG_FILTER_ADAPTIVE ? RENDERER_PNG_FILTER_NONE : filter;
+    int lasttype = filter == RENDERER_PNG_FILTER_ADAPTIVE ? RENDERER_PNG_FILTER_PAETH : filter;
+    const unsigned char * bestrow = NULL;
+    size_t bestsum = SIZE_MAX;
+    for (int type = firsttype; type <= lasttype; type += 1) {
+        unsigned char * row = rows + (size_t)type * (length + 1);
+        row[0] = (unsigned char)type;
+        if (type == RENDERER_PNG_FILTER_NONE || (type == RENDERER_PNG_FILTER_UP && previous == NULL)) {
+            memcpy(row + 1, current, length);
+        } else if (type == RENDERER_PNG_FILTER_SUB || (type == RENDERER_PNG_FILTER_PAETH && previous == NULL)) {
+            memcpy(row + 1, current, 4);
+            for (size_t i = 4; i < length; i += 1) {
+                row[i + 1] = (unsigned char)(current[i] - current[i - 4]);
+            }
+        } else if (type == RENDERER_PNG_FILTER_UP) {
+            for (size_t i = 0; i < length; i += 1) {
+                row[i + 1] = (unsigned char)(current[i] - previous[i]);
+            }
+        } else if (type == RENDERER_PNG_FILTER_AVERAGE) {
+            for (size_t i = 0; i < length; i += 1) {
+                unsigned int left = i < 4 ? 0U : current[i - 4];
+                unsigned int above = previous == NULL ? 0U : previous[i];
+                row[i + 1] = (unsigned char)(current[i] - (left + above) / 2U);
+            }
+        } else {
+            for (size_t i = 0; i < length; i += 1) {
+                int left = i < 4 ? 0 : current[i - 4];
+                int above = previous[i];
+                int upperleft = i < 4 ? 0 : previous[i - 4];
+                int estimate = left + above - upperleft;
+                int leftdistance = abs(estimate - left);
+                int abovedistance = abs(estimate - above);
+                int upperleftdistance = abs(estimate - upperleft);
+                int predictor = leftdistance <= abovedistance && leftdistance <= upperleftdistance ? left : abovedistance <= upperleftdistance ? above : upperleft;
+                row[i + 1] = (unsigned char)(current[i] - predictor);
+            }
+        }
+        if (filter != RENDERER_PNG_FILTER_ADAPTIVE) {
+            return row;
+        }
+
+        /* Same heuristic as libpng, the smallest sum of the filtered bytes taken as signed values */
+        size_t sum = 0;
+        for (size_t i = 1; i <= length; i += 1) {
+            sum += row[i] < 128U ? row[i] : 256U - row[i];
+        }
+        if (sum < bestsum) {
+            bestsum = sum;
+            bestrow = row;
+        }
+    }
+    return bestrow;
+}
+
+static bool writepngchunk(FILE * filepointer, const char * type, const unsigned char * data, size_t size)
+{
+    unsigned char header[8];
+    storebigendian(header, (uint32_t)size);
+    memcpy(&header[4], type, 4);
+    uLong crc = crc32(0L, &header[4], 4);
+    if (size != 0) {
+        crc = crc32(crc, data, (uInt)size);
+    }
+    unsigned char trailer[4];
+    storebigendian(trailer, (uint32_t)crc);
+    return fwrite(header, sizeof header, 1, filepointer) == 1 && (size == 0 || fwrite(data, size, 1, filepointer) == 1) && fwrite(trailer, sizeof trailer, 1, filepointer) == 1;
+}
+
+static void storebigendian(unsigned char * bytes, uint32_t value)
+{
+    bytes[0] = (unsigned char)(value >> 24);
+    bytes[1] = (unsigned char)(value >> 16);
+    bytes[2] = (unsigned char)(value >> 8);
+    bytes[3] = (unsigned char)value;
+}
+
+static int getoutputformat(const renderer_context * context, const char * filename)
+{
+    /* Auto picks the format from the file extension and falls back to PNG */
+    if (context->outputformat != RENDERER_OUTPUT_FORMAT_AUTO) {
+        return context->outputformat;
+    } else if (hasfileextension(filename, ".ppm")) {
+        return RENDERER_OUTPUT_FORMAT_PPM;
+    } else if (hasfileextension(filename, ".pam")) {
+        return RENDERER_OUTPUT_FORMAT_PAM;
+    } else if (hasfileextension(filename, ".qoi")) {
+        return RENDERER_OUTPUT_FORMAT_QOI;
+    } else if (hasfileextension(filename, ".rgba")) {
+        return RENDERER_OUTPUT_FORMAT_RAW;
+    } else {
+        return RENDERER_OUTPUT_FORMAT_PNG;
+    }
+}
+
+static bool hasfileextension(const char * filename, const char * extension)
+{
+    size_t filenamelength = strlen(filename);
+    size_t extensionlength = strlen(extension);
+    if (filenamelength < extensionlength) {
+        return false;
+    }
+    filename += filenamelength - extensionlength;
+    for (size_t i = 0; i < extensionlength; i += 1) {
+        if (tolower((unsigned char)filename[i]) != extension[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool writeppm(const surface * s, FILE * filepointer)
+{
+    /* Binary PPM has no alpha channel, so rows are packed to RGB first */
+    unsigned char * row = malloc((size_t)s->width * 3);
+    if (row == NULL) {
+        return false;
+    }
+    bool written = fprintf(filepointer, "P6\n%u %u\n255\n", (unsigned int)s->width, (unsigned int)s->height) > 0;
+    for (size_t y = 0; written && y < (size_t)s->height; y += 1) {
+        const uint32_t * pixels = &s->pixels[y * (size_t)s->width];
+        for (size_t x = 0; x < (size_t)s->width; x += 1) {
+            row[x * 3] = (unsigned char)pixels[x];
+            row[x * 3 + 1] = (unsigned char)(pixels[x] >> 8);
+            row[x * 3 + 2] = (unsigned char)(pixels[x] >> 16);
+        }
+        written = fwrite(row, (size_t)s->width * 3, 1, filepointer) == 1;
+    }
+    free(row);
+    return written;
+}
+
+static bool writepam(const surface * s, FILE * filepointer)
+{
+    return fprintf(filepointer, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n", (unsigned int)s->width, (unsigned int)s->height) > 0 &&
+        writergbapixels(s->pixels, (size_t)s->width * s->height, filepointer);
+}
+
+static bool writeqoi(const surface * s, FILE * filepointer)
+{
+    unsigned char * buffer = malloc(QOI_BUFFER_SIZE);
+    if (buffer == NULL) {
+        return false;
+    }
+    memcpy(buffer, "qoif", 4);
+    storebigendian(&buffer[4], s->width);
+    storebigendian(&buffer[8], s->height);
+    buffer[12] = 4;
+    buffer[13] = 0;
+    size_t used = 14;
+
+    /* Encoded pixels are collected in a fixed buffer that is flushed whenever the longest operation might not fit */
+    bool written = true;
+    unsigned char seen[64][4] = {{0}};
+    unsigned char previous[4] = {0, 0, 0, 255};
+    unsigned int run = 0U;
+    size_t pixelcount = (size_t)s->width * s->height;
+    for (size_t i = 0; written && i < pixelcount; i += 1) {
+        unsigned char pixel[4];
+        storelittleendian(pixel, s->pixels[i]);
+        if (memcmp(pixel, previous, 4) == 0) {
+            run += 1U;
+            if (run == 62U) {
+                buffer[used++] = (unsigned char)(0xC0U | (run - 1U));
+                run = 0U;
+            }
+        } else {
+            if (run > 0U) {
+                buffer[used++] = (unsigned char)(0xC0U | (run - 1U));
+                run = 0U;
+            }
+            unsigned int hash = (pixel[0] * 3U + pixel[1] * 5U + pixel[2] * 7U + pixel[3] * 11U) % 64U;
+            if (memcmp(seen[hash], pixel, 4) == 0) {
+                buffer[used++] = (unsigned char)hash;
+            } else if (pixel[3] == previous[3]) {
+                int reddifference = (signed char)(pixel[0] - previous[0]);
+                int greendifference = (signed char)(pixel[1] - previous[1]);
+                int bluedifference = (signed char)(pixel[2] - previous[2]);
+                int redgreendifference = reddifference - greendifference;
+                int bluegreendifference = bluedifference - greendifference;
+                if (reddifference >= -2 && reddifference <= 1 && greendifference >= -2 && greendifference <= 1 && bluedifference >= -2 && bluedifference <= 1) {
+                    buffer[used++] = (unsigned char)(0x40 | (reddifference + 2) << 4 | (greendifference + 2) << 2 | (bluedifference + 2));
+                } else if (greendifference >= -32 && greendifference <= 31 && redgreendifference >= -8 && redgreendifference <= 7 && bluegreendifference >= -8 && bluegreendifference <= 7) {
+                    buffer[used++] = (unsigned char)(0x80 | (greendifference + 32));
+                    buffer[used++] = (unsigned char)((redgreendifference + 8) << 4 | (bluegreendifference + 8));
+                } else {
+                    buffer[used++] = 0xFE;
+                    memcpy(&buffer[used], pixel, 3);
+                    used += 3;
+                }
+            } else {
+                buffer[used++] = 0xFF;
+                memcpy(&buffer[used], pixel, 4);
+                used += 4;
+            }
+            memcpy(seen[hash], pixel, 4);
+            memcpy(previous, pixel, 4);
+        }
+        if (used > QOI_BUFFER_SIZE - 16) {
+            written = fwrite(buffer, used, 1, filepointer) == 1;
+            used = 0;
+        }
+    }
+
+    static const unsigned char end[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+    if (run > 0U) {
+        buffer[used++] = (unsigned char)(0xC0U | (run - 1U));
+    }
+    memcpy(&buffer[used], end, sizeof end);
+    used += sizeof end;
+    written = written && fwrite(buffer, used, 1, filepointer) == 1;
+    free(buffer);
+    return written;
+}
+
+static bool writerawrgba(const surface * s, FILE * filepointer)
+{
+    /* A 12 byte header of RAW_RGBA_MAGIC and the little-endian width and height, followed by R, G, B, A bytes row by row */
+    unsigned char header[12];
+    memcpy(header, RAW_RGBA_MAGIC, 4);
+    storelittleendian(&header[4], s->width);
+    storelittleendian(&header[8], s->height);
+
+    /* Without buffering the pixels go out in a single write instead of being copied through the stream buffer */
+    setvbuf(filepointer, NULL, _IONBF, 0);
+    return fwrite(header, sizeof header, 1, filepointer) == 1 && writergbapixels(s->pixels, (size_t)s->width * s->height, filepointer);
+}
+
+static bool writergbapixels(const uint32_t * pixels, size_t count, FILE * filepointer)
+{
+    /* Red is the low byte of a pixel, so the pixels can only be written as they are where that byte comes first in memory */
+    static const uint32_t byteorder = 1U;
+    if (*(const unsigned char *)&byteorder == 1U) {
+        return fwrite(pixels, count * 4, 1, filepointer) == 1;
+    }
+    unsigned char bytes[4096];
+    for (size_t i = 0; i < count; i += sizeof bytes / 4) {
+        size_t chunk = count - i < sizeof bytes / 4 ? count - i : sizeof bytes / 4;
+        for (size_t j = 0; j < chunk; j += 1) {
+            storelittleendian(&bytes[j * 4], pixels[i + j]);
+        }
+        if (fwrite(bytes, chunk * 4, 1, filepointer) != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void storelittleendian(unsigned char * bytes, uint32_t value)
+{
+    bytes[0] = (unsigned char)value;
+    bytes[1] = (unsigned char)(value >> 8);
+    bytes[2] = (unsigned char)(value >> 16);
+    bytes[3] = (unsigned char)(value >> 24);
+}
+
+static void batchrenderworker(void * argument)
+{
+    batchworker * worker = argument;
+    renderer_batch * batch = worker->batch;
+    lockmutex(&batch->mutex);
+    for (;;) {
+        /* A frame is only taken along with a surface, so the oldest frame in flight never waits behind newer ones */
+        while ((batch->pendingcount == 0 && !batch->closing) || (batch->pendingcount != 0 && batch->freesurfacecount == 0 && batch->surfacecount == batch->surfacecapacity)) {
+            waitconditionvariable(&batch->changed, &batch->mutex);
+        }
+        if (batch->pendingcount == 0) {
+            break;
+        }
+        batchframe frame = batch->pending[batch->pendingfirst];
+        batch->pendingfirst = (batch->pendingfirst + 1) % batch->pendingcapacity;
+        batch->pendingcount -= 1;
+        broadcastconditionvariable(&batch->changed);
+
+        /* Reuse a surface the encoders are done with, new ones are made up to the cap */
+        if (batch->freesurfacecount != 0) {
+            batch->freesurfacecount -= 1;
+            frame.target = batch->freesurfaces[batch->freesurfacecount];
+        } else {
+            batch->surfacecount += 1;
+        }
+        int error = batch->errornumber;
+        unlockmutex(&batch->mutex);
+
+        if (error == RENDERER_ERROR_NONE) {
+            setconfigurations_ctx(worker->context, &frame.configuration);
+            error = geterror_ctx(worker->context);
+        }
+        if (error == RENDERER_ERROR_NONE) {
+            if (frame.target != NULL && (frame.target->width != frame.configuration.outputwidth || frame.target->height != frame.configuration.outputheight)) {
+                releasesurface(&frame.target);
+            }
+            if (frame.target == NULL) {
+                frame.target = createrendertarget_ctx(worker->context);
+                error = geterror_ctx(worker->context);
+            }
+        }
+        if (error == RENDERER_ERROR_NONE) {
+            rendersurface_ctx(worker->context, batch->rawtriangles, frame.target);
+            error = geterror_ctx(worker->context);
+        }
+
+        lockmutex(&batch->mutex);
+        if (error == RENDERER_ERROR_NONE) {
+            batch->finished[(batch->finishedfirst + batch->finishedcount) % batch->surfacecapacity] = frame;
+            batch->finishedcount += 1;
+        } else {
+            setbatcherror(batch, error);
+            free(frame.filename);
+            if (frame.target != NULL) {
+                batch->freesurfaces[batch->freesurfacecount] = frame.target;
+                batch->freesurfacecount += 1;
+            } else {
+                batch->surfacecount -= 1;
+            }
+        }
+        broadcastconditionvariable(&batch->changed);
+    }
+    batch->runningrenderers -= 1;
+    broadcastconditionvariable(&batch->changed);
+    unlockmutex(&batch->mutex);
+}
+
+static void batchencodeworker(void * argument)
+{
+    batchworker * worker = argument;
+    renderer_batch * batch = worker->batch;
+    lockmutex(&batch->mutex);
+    for (;;) {
+        batchframe frame;
+        bool taken;
+        while (!(taken = takefinishedframe(batch, &frame)) && !(batch->closing && batch->runningrenderers == 0)) {
+            waitconditionvariable(&batch->changed, &batch->mutex);
+        }
+        if (!taken) {
+            break;
+        }
+        int error = batch->errornumber;
+        unlockmutex(&batch->mutex);
+
+        if (error == RENDERER_ERROR_NONE && batch->stream != NULL) {
+            tracezone zone;
+            begintracezone(&zone, "write frame");
+            if (!writergbapixels(frame.target->pixels, (size_t)frame.target->width * frame.target->height, batch->stream)) {
+                error = RENDERER_ERROR_FILEWRITEFAILED;
+            }
+            endtracezone(&zone);
+        } else if (error == RENDERER_ERROR_NONE) {
+            savesurfacetofile_ctx(worker->context, frame.target, frame.filename);
+            error = geterror_ctx(worker->context);
+        }
+        free(frame.filename);
+
+        lockmutex(&batch->mutex);
+        setbatcherror(batch, error);
+        batch->nextsequence += 1;
+        batch->freesurfaces[batch->freesurfacecount] = frame.target;
+        batch->freesurfacecount += 1;
+        broadcastconditionvariable(&batch->changed);
+    }
+    unlockmutex(&batch->mutex);
+}
+
+static bool takefinishedframe(renderer_batch * batch, batchframe * frame)
+{
+    /* A stream gets the frames in submission order, a later frame waits until the one before it is written */
+    size_t index = 0;
+    if (batch->stream != NULL && batch->errornumber == RENDERER_ERROR_NONE) {
+        while (index < batch->finishedcount && batch->finished[(batch->finishedfirst + index) % batch->surfacecapacity].sequence != batch->nextsequence) {
+            index += 1;
+        }
+    }
+    if (index == batch->finishedcount) {
+        return false;
+    }
+    batchframe * first = &batch->finished[batch->finishedfirst];
+    batchframe * found = &batch->finished[(batch->finishedfirst + index) % batch->surfacecapacity];
+    *frame = *found;
+    *found = *first;
+    batch->finishedfirst = (batch->finishedfirst + 1) % batch->surfacecapacity;
+    batch->finishedcount -= 1;
+    return true;
+}
+
+static void setbatcherror(renderer_batch * batch, int error)
+{
+    /* Keeps the first failure, later frames are skipped */
+    if (batch->errornumber == RENDERER_ERROR_NONE) {
+        batch->errornumber = error;
+    }
+}
+
+static unsigned int getprocessorcount(void)
+{
+#if defined(_WIN32)
+    SYSTEM_INFO systeminfo;
+    GetSystemInfo(&systeminfo);
+    return systeminfo.dwNumberOfProcessors == 0 ? 1U : (unsigned int)systeminfo.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count < 1 ? 1U : (unsigned int)count;
+#endif
+}
+
+static double getmilliseconds(void)
+{
+    /* Monotonic wall-clock time, only differences between two calls mean anything */
+#if defined(_WIN32)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1000.0 + (double)now.tv_nsec / 1000000.0;
+#endif
+}
+
+static void begintracezone(tracezone * zone, const char * name)
+{
+    /* Without a trace file a zone costs one test here and one in endtracezone */
+    zone->name = NULL;
+    if (loadtracefile() != NULL) {
+        zone->name = name;
+        zone->start = getmilliseconds();
+    }
+}
+
+static void endtracezone(const tracezone * zone)
+{
+    if (zone->name == NULL) {
+        return;
+    }
+    double end = getmilliseconds();
+    lockmutex(&tracemutex);
+    if (tracefile == NULL || zone->start < tracestart) {
+        unlockmutex(&tracemutex);
+        return;
+    }
+    int written = fprintf(tracefile, "%s\n{\"name\":\"%s\",\"cat\":\"renderer\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+        traceeventwritten ? "," : "", zone->name, gettracethread(), (zone->start - tracestart) * 1000.0, (end - zone->start) * 1000.0);
+    if (written < 0) {
+        tracewritefailed = true;
+    }
+    traceeventwritten = true;
+    unlockmutex(&tracemutex);
+}
+
+static unsigned int gettracethread(void)
+{
+    /* Called with the trace mutex held, lanes from an earlier trace do not carry over */
+    if (tracethreadgeneration != tracegeneration) {
+        tracethreadgeneration = tracegeneration;
+        tracethread = TRACE_THREAD_SLOTS + traceoverflowthreads + 1U;
+        for (unsigned int slot = 0; slot < TRACE_THREAD_SLOTS; slot += 1) {
+            if (!tracethreadslots[slot]) {
+                tracethreadslots[slot] = true;
+                tracethread = slot + 1U;
+                break;
             }
         }
-        temptriangle = triangletable[left];
-        triangletable[left] = triangletable[end];
-        triangletable[end] = temptriangle;
-        templight = lightingtable[left];
-        lightingtable[left] = lightingtable[end];
-        lightingtable[end] = templight;
-        zsortingsubroutine(triangletable, lightingtable, start, left - 1);
-        zsortingsubroutine(triangletable, lightingtable, left + 1, end);
+        if (tracethread > TRACE_THREAD_SLOTS) {
+            traceoverflowthreads += 1U;
+        }
+    }
+    return tracethread;
+}
+
+static void releasetracethread(void)
+{
+    /* Batch threads are short-lived, handing back their lane keeps one lane per concurrent thread in the viewer */
+    if (loadtracefile() == NULL) {
+        return;
+    }
+    lockmutex(&tracemutex);
+    if (tracefile != NULL && tracethreadgeneration == tracegeneration && tracethread <= TRACE_THREAD_SLOTS) {
+        tracethreadslots[tracethread - 1U] = false;
+    }
+    tracethreadgeneration = 0U;
+    unlockmutex(&tracemutex);
+}
+
+static void initializetracemutex(void)
+{
+    /* The mutex lives as long as the process, threads may still be finishing a zone when the trace is closed */
+    initializemutex(&tracemutex);
+}
+
+static FILE * loadtracefile(void)
+{
+    /* tracefile is only changed under the trace mutex, but zones test it without taking the lock */
+#if defined(_WIN32)
+    return InterlockedCompareExchangePointer((PVOID volatile *)&tracefile, NULL, NULL);
+#else
+    return __atomic_load_n(&tracefile, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static void storetracefile(FILE * filepointer)
+{
+#if defined(_WIN32)
+    InterlockedExchangePointer((PVOID volatile *)&tracefile, filepointer);
+#else
+    __atomic_store_n(&tracefile, filepointer, __ATOMIC_RELEASE);
+#endif
+}
+
+static void runinparallel(void (* procedure)(void *), void * arguments, size_t argumentsize, size_t count)
+{
+    /* Runs procedure on count arguments spaced argumentsize bytes apart, the calling thread works through them alongside the pool */
+    if (count <= 1) {
+        if (count == 1) {
+            procedure(arguments);
+        }
+        return;
+    }
+    runonce(&threadpoolonce, initializethreadpool);
+    paralleljob job;
+    job.procedure = procedure;
+    job.arguments = arguments;
+    job.argumentsize = argumentsize;
+    job.count = count;
+    job.nextitem = 0;
+    job.finisheditems = 0;
+    job.next = NULL;
+
+    lockmutex(&threadpoolmutex);
+    while (threadpoolsize < count - 1 && threadpoolsize < THREAD_POOL_MAXIMUM_SIZE && startthread(&threadpoolthreads[threadpoolsize], threadpoolworker, NULL)) {
+        threadpoolsize += 1;
+    }
+    paralleljob * * link = &threadpooljobs;
+    while (*link != NULL) {
+        link = &(*link)->next;
+    }
+    *link = &job;
+    broadcastconditionvariable(&threadpoolwork);
+
+    /* Items nobody else has taken run here, so a call finishes even when every pool thread is busy elsewhere */
+    while (job.nextitem < job.count) {
+        runparallelitem(&job);
+    }
+    while (job.finisheditems < job.count) {
+        waitconditionvariable(&threadpooldone, &threadpoolmutex);
+    }
+    link = &threadpooljobs;
+    while (*link != &job) {
+        link = &(*link)->next;
+    }
+    *link = job.next;
+    unlockmutex(&threadpoolmutex);
+}
+
+static void runparallelitem(paralleljob * job)
+{
+    /* Called with an item left and the pool mutex held, the item itself runs unlocked */
+    size_t item = job->nextitem;
+    job->nextitem += 1;
+    unlockmutex(&threadpoolmutex);
+    job->procedure(job->arguments + item * job->argumentsize);
+    lockmutex(&threadpoolmutex);
+    job->finisheditems += 1;
+    if (job->finisheditems == job->count) {
+        broadcastconditionvariable(&threadpooldone);
+    }
+}
+
+static void threadpoolworker(void * argument)
+{
+    /* Takes items from the oldest job that has any left and sleeps while there are none */
+    (void)argument;
+    lockmutex(&threadpoolmutex);
+    for (;;) {
+        paralleljob * job = threadpooljobs;
+        while (job != NULL && job->nextitem == job->count) {
+            job = job->next;
+        }
+        if (job == NULL) {
+            waitconditionvariable(&threadpoolwork, &threadpoolmutex);
+        } else {
+            runparallelitem(job);
+        }
     }
 }
+
+static void initializethreadpool(void)
+{
+    initializemutex(&threadpoolmutex);
+    initializeconditionvariable(&threadpoolwork);
+    initializeconditionvariable(&threadpooldone);
+}
+
+#if defined(_WIN32)
+static BOOL CALLBACK runoncecallback(PINIT_ONCE once, PVOID parameter, PVOID * context)
+{
+    (void)once;
+    (void)context;
+    void (* const * procedure)(void) = parameter;
+    (*procedure)();
+    return TRUE;
+}
+#endif
+
+static void runonce(rendereronce * once, void (* procedure)(void))
+{
+#if defined(_WIN32)
+    InitOnceExecuteOnce(once, runoncecallback, &procedure, NULL);
+#else
+    pthread_once(once, procedure);
+#endif
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI threadentry(LPVOID argument)
+{
+    rendererthread * thread = argument;
+    thread->procedure(thread->argument);
+    releasetracethread();
+    return 0;
+}
+#else
+static void * threadentry(void * argument)
+{
+    rendererthread * thread = argument;
+    thread->procedure(thread->argument);
+    releasetracethread();
+    return NULL;
+}
+#endif
+
+static bool startthread(rendererthread * thread, void (* procedure)(void *), void * argument)
+{
+    thread->procedure = procedure;
+    thread->argument = argument;
+#if defined(_WIN32)
+    thread->handle = CreateThread(NULL, 0, threadentry, thread, 0, NULL);
+    return thread->handle != NULL;
+#else
+    return pthread_create(&thread->handle, NULL, threadentry, thread) == 0;
+#endif
+}
+
+static void jointhread(rendererthread * thread)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+}
+
+static void initializemutex(renderermutex * mutex)
+{
+#if defined(_WIN32)
+    InitializeCriticalSection(mutex);
+#else
+    pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+static void lockmutex(renderermutex * mutex)
+{
+#if defined(_WIN32)
+    EnterCriticalSection(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+static void unlockmutex(renderermutex * mutex)
+{
+#if defined(_WIN32)
+    LeaveCriticalSection(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+static void destroymutex(renderermutex * mutex)
+{
+#if defined(_WIN32)
+    DeleteCriticalSection(mutex);
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+static void initializeconditionvariable(rendererconditionvariable * conditionvariable)
+{
+#if defined(_WIN32)
+    InitializeConditionVariable(conditionvariable);
+#else
+    pthread_cond_init(conditionvariable, NULL);
+#endif
+}
+
+static void waitconditionvariable(rendererconditionvariable * conditionvariable, renderermutex * mutex)
+{
+#if defined(_WIN32)
+    SleepConditionVariableCS(conditionvariable, mutex, INFINITE);
+#else
+    pthread_cond_wait(conditionvariable, mutex);
+#endif
+}
+
+static void broadcastconditionvariable(rendererconditionvariable * conditionvariable)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable(conditionvariable);
+#else
+    pthread_cond_broadcast(conditionvariable);
+#endif
+}
+
+static void destroyconditionvariable(rendererconditionvariable * conditionvariable)
+{
+#if defined(_WIN32)
+    (void)conditionvariable;
+#else
+    pthread_cond_destroy(conditionvariable);
+#endif
+}
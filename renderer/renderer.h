@@ -2,6 +2,8 @@
 #define RENDERER_H
 
 #include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
 
 #define RENDERER_ERROR_NONE 0
 #define RENDERER_ERROR_INVALIDVALUE 1
@@ -10,6 +12,22 @@
 #define RENDERER_ERROR_INSUFFICIENTMEMORY 4
 #define RENDERER_ERROR_LINETOOLONG 5
 #define RENDERER_ERROR_CONFIGWRONGFORMAT 6
+#define RENDERER_ERROR_FILEWRITEFAILED 7
+#define RENDERER_ERROR_BINARYWRONGFORMAT 8
+
+#define RENDERER_PNG_FILTER_NONE 0
+#define RENDERER_PNG_FILTER_SUB 1
+#define RENDERER_PNG_FILTER_UP 2
+#define RENDERER_PNG_FILTER_AVERAGE 3
+#define RENDERER_PNG_FILTER_PAETH 4
+#define RENDERER_PNG_FILTER_ADAPTIVE 5
+
+#define RENDERER_OUTPUT_FORMAT_AUTO 0
+#define RENDERER_OUTPUT_FORMAT_PNG 1
+#define RENDERER_OUTPUT_FORMAT_PPM 2
+#define RENDERER_OUTPUT_FORMAT_PAM 3
+#define RENDERER_OUTPUT_FORMAT_QOI 4
+#define RENDERER_OUTPUT_FORMAT_RAW 5
 
 typedef struct point {
     float x;
@@ -29,6 +47,10 @@ typedef struct triangle {
 typedef struct triangles {
     size_t size;
     triangle * data;
+    void * mapping;
+    void * mesh;
+    uint64_t sourcesize;
+    uint64_t sourcemodified;
 } triangles;
 
 typedef struct configurations {
@@ -63,27 +85,89 @@ typedef struct configurations {
     int materialdiffusereflectanceblue;
     int backfaceculling;
     int usezbuffer;
+    int fronttobacksort;
+    unsigned int renderthreads;
+    unsigned int antialiasing;
+    int pngcompressionlevel;
+    int pngfilter;
+    int pngparalleldeflate;
+    int outputformat;
 } configurations;
 
+typedef struct renderer_stats {
+    double culltime;
+    double transformtime;
+    double lighttime;
+    double cliptime;
+    double sorttime;
+    double rastertime;
+    double resolvetime;
+    double encodetime;
+    size_t trianglesin;
+    size_t trianglesculled;
+    size_t trianglesclipped;
+    size_t trianglessplit;
+    size_t trianglesrasterized;
+    uint64_t samplestested;
+    uint64_t sampleswritten;
+    size_t peakscratchmemory;
+} renderer_stats;
+
+typedef struct renderer_context renderer_context;
+typedef struct renderer_batch renderer_batch;
+
 typedef struct surface {
     uint16_t width;
     uint16_t height;
     uint32_t pixels[1];
 } surface;
 
+renderer_context * createrenderercontext(void);
+void releaserenderercontext(renderer_context * *);
+
 int geterror(void);
+int geterror_ctx(const renderer_context *);
 const char * geterrortext(int);
 
+size_t loadtriangles(const char *, triangles *);
+size_t loadtriangles_ctx(renderer_context *, const char *, triangles *);
 size_t loadrawtriangles(const char *, triangles *);
+size_t loadrawtriangles_ctx(renderer_context *, const char *, triangles *);
+size_t loadbinarytriangles(const char *, triangles *);
+size_t loadbinarytriangles_ctx(renderer_context *, const char *, triangles *);
+void savebinarytriangles(const triangles *, const char *);
+void savebinarytriangles_ctx(renderer_context *, const triangles *, const char *);
 void releasetriangles(triangles *);
 
 void readconfigurations(void);
+void readconfigurations_ctx(renderer_context *);
+void setconfiguration(const char *, const char *);
+void setconfiguration_ctx(renderer_context *, const char *, const char *);
 void getconfigurations(configurations *);
+void getconfigurations_ctx(renderer_context *, configurations *);
+void setconfigurations(const configurations *);
+void setconfigurations_ctx(renderer_context *, const configurations *);
 
 surface * createsurface(uint16_t, uint16_t);
+surface * createsurface_ctx(renderer_context *, uint16_t, uint16_t);
 surface * createrendertarget(void);
+surface * createrendertarget_ctx(renderer_context *);
 void releasesurface(surface * *);
 void rendersurface(const triangles *, surface *);
+void rendersurface_ctx(renderer_context *, const triangles *, surface *);
 void savesurfacetopngfile(const surface *, const char *);
+void savesurfacetopngfile_ctx(renderer_context *, const surface *, const char *);
+void savesurfacetofile(const surface *, const char *);
+void savesurfacetofile_ctx(renderer_context *, const surface *, const char *);
+void getrenderstats(renderer_stats *);
+void getrenderstats_ctx(const renderer_context *, renderer_stats *);
+
+int opentracefile(const char *);
+int closetracefile(void);
+
+renderer_batch * createrendererbatch(const triangles *, unsigned int, unsigned int);
+renderer_batch * createrendererbatchstream(const triangles *, unsigned int, unsigned int, FILE *);
+int submitbatchframe(renderer_batch *, const configurations *, const char *);
+int finishrendererbatch(renderer_batch * *);
 
 #endif